@@ -0,0 +1,57 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef CORE__BYTE_SOURCE_HPP_
+#define CORE__BYTE_SOURCE_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ssl_ros_bridge::core
+{
+
+/**
+ * Sequential source of log bytes delivered in blocks, for inputs which cannot be mapped directly.
+ */
+class ByteSource {
+public:
+  using Block = std::shared_ptr<const std::vector<uint8_t>>;
+
+  virtual ~ByteSource() = default;
+
+  /**
+   * Returns the next block of log bytes, or nullptr at the end of the input.
+   *
+   * Blocks stay valid for as long as a reference to them is held.
+   *
+   * @throws std::runtime_error if the input is corrupt
+   */
+  virtual Block ReadBlock() = 0;
+
+  /**
+   * Returns the fraction of the input consumed so far, from 0 to 1.
+   */
+  virtual double GetProgress() const = 0;
+};
+
+}  // namespace ssl_ros_bridge::core
+
+#endif  // CORE__BYTE_SOURCE_HPP_
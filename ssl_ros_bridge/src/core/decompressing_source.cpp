@@ -0,0 +1,321 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "decompressing_source.hpp"
+
+#include <zlib.h>
+#include <zstd.h>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ssl_ros_bridge::core
+{
+
+namespace
+{
+
+class Decoder {
+public:
+  virtual ~Decoder() = default;
+
+  /**
+   * Decompresses as much as fits into output, advancing input past the bytes consumed.
+   *
+   * @return Number of bytes written to output. Zero once all input has been decompressed.
+   */
+  virtual std::size_t Decode(std::span<const uint8_t> & input, std::span<uint8_t> output) = 0;
+
+  /**
+   * @throws std::runtime_error if the input ended in the middle of a compressed stream
+   */
+  virtual void CheckFinished() const = 0;
+
+protected:
+  /**
+   * Throws the error found by an earlier call once the bytes decoded before it were returned.
+   */
+  void ThrowPendingError() const
+  {
+    if(!pending_error_.empty()) {
+      throw std::runtime_error(pending_error_);
+    }
+  }
+
+  /**
+   * Reports a corrupt stream, deferring the exception if some bytes were decoded first.
+   *
+   * @return bytes_produced, if the error was deferred
+   */
+  std::size_t Fail(std::string message, const std::size_t bytes_produced)
+  {
+    if(bytes_produced == 0) {
+      throw std::runtime_error(message);
+    }
+    pending_error_ = std::move(message);
+    return bytes_produced;
+  }
+
+private:
+  std::string pending_error_;
+};
+
+class GzipDecoder : public Decoder {
+public:
+  GzipDecoder()
+  {
+    // Adding 32 to the window bits accepts both gzip and zlib headers
+    if(inflateInit2(&stream_, MAX_WBITS + 32) != Z_OK) {
+      throw std::runtime_error("Could not initialize gzip decoder.");
+    }
+  }
+
+  ~GzipDecoder() override
+  {
+    inflateEnd(&stream_);
+  }
+
+  std::size_t Decode(std::span<const uint8_t> & input, std::span<uint8_t> output) override
+  {
+    ThrowPendingError();
+    const auto input_size = std::min<std::size_t>(input.size(), UINT_MAX);
+    const auto output_size = std::min<std::size_t>(output.size(), UINT_MAX);
+    stream_.next_in = const_cast<Bytef *>(input.data());
+    stream_.avail_in = input_size;
+    stream_.next_out = output.data();
+    stream_.avail_out = output_size;
+    const auto result = inflate(&stream_, Z_NO_FLUSH);
+    const auto bytes_consumed = input_size - stream_.avail_in;
+    const auto bytes_produced = output_size - stream_.avail_out;
+    input = input.subspan(bytes_consumed);
+    if(bytes_consumed > 0) {
+      in_stream_ = true;
+    }
+    if(result == Z_STREAM_END) {
+      // Concatenated gzip members continue the same log
+      in_stream_ = false;
+      inflateReset(&stream_);
+    } else if(result != Z_OK && !(result == Z_BUF_ERROR && input.empty())) {
+      return Fail(
+        std::string("Compressed log is corrupt: ") +
+        (stream_.msg != nullptr ? stream_.msg : "gzip error"), bytes_produced);
+    }
+    return bytes_produced;
+  }
+
+  void CheckFinished() const override
+  {
+    if(in_stream_) {
+      throw std::runtime_error("Compressed log is truncated.");
+    }
+  }
+
+private:
+  z_stream stream_{};
+  bool in_stream_{false};
+};
+
+class ZstdDecoder : public Decoder {
+public:
+  ZstdDecoder()
+  : context_(ZSTD_createDCtx())
+  {
+    if(context_ == nullptr) {
+      throw std::runtime_error("Could not initialize zstd decoder.");
+    }
+  }
+
+  ~ZstdDecoder() override
+  {
+    ZSTD_freeDCtx(context_);
+  }
+
+  std::size_t Decode(std::span<const uint8_t> & input, std::span<uint8_t> output) override
+  {
+    ThrowPendingError();
+    ZSTD_inBuffer in_buffer{input.data(), input.size(), 0};
+    ZSTD_outBuffer out_buffer{output.data(), output.size(), 0};
+    const auto result = ZSTD_decompressStream(context_, &out_buffer, &in_buffer);
+    input = input.subspan(in_buffer.pos);
+    if(ZSTD_isError(result)) {
+      return Fail(
+        std::string("Compressed log is corrupt: ") + ZSTD_getErrorName(result), out_buffer.pos);
+    }
+    if(in_buffer.pos > 0 || out_buffer.pos > 0) {
+      // Zero means the current frame is complete and fully flushed
+      frame_incomplete_ = result != 0;
+    }
+    return out_buffer.pos;
+  }
+
+  void CheckFinished() const override
+  {
+    if(frame_incomplete_) {
+      throw std::runtime_error("Compressed log is truncated.");
+    }
+  }
+
+private:
+  ZSTD_DCtx * context_;
+  bool frame_incomplete_{false};
+};
+
+}  // namespace
+
+std::optional<CompressionFormat> DetectCompression(std::span<const uint8_t> data)
+{
+  constexpr std::array<uint8_t, 2> gzip_magic = {0x1f, 0x8b};
+  constexpr std::array<uint8_t, 4> zstd_magic = {0x28, 0xb5, 0x2f, 0xfd};
+  if(data.size() >= gzip_magic.size() && std::ranges::equal(data.first(2), gzip_magic)) {
+    return CompressionFormat::Gzip;
+  }
+  if(data.size() >= zstd_magic.size() && std::ranges::equal(data.first(4), zstd_magic)) {
+    return CompressionFormat::Zstd;
+  }
+  return std::nullopt;
+}
+
+DecompressingSource::DecompressingSource(
+  std::span<const uint8_t> compressed_data,
+  const CompressionFormat format)
+: compressed_data_(compressed_data),
+  format_(format)
+{
+  decompression_thread_ = std::thread(&DecompressingSource::RunDecompression, this);
+}
+
+DecompressingSource::~DecompressingSource()
+{
+  {
+    std::lock_guard lock(mutex_);
+    stopping_ = true;
+  }
+  condition_.notify_all();
+  decompression_thread_.join();
+}
+
+ByteSource::Block DecompressingSource::ReadBlock()
+{
+  std::unique_lock lock(mutex_);
+  condition_.wait(lock, [this]() {return finished_ || !ready_blocks_.empty();});
+  if(!ready_blocks_.empty()) {
+    auto block = std::move(ready_blocks_.front());
+    ready_blocks_.pop_front();
+    condition_.notify_all();
+    return block;
+  }
+  if(!error_.empty()) {
+    throw std::runtime_error(error_);
+  }
+  return nullptr;
+}
+
+double DecompressingSource::GetProgress() const
+{
+  if(compressed_data_.empty()) {
+    return 1.0;
+  }
+  return static_cast<double>(input_bytes_consumed_) / compressed_data_.size();
+}
+
+void DecompressingSource::RunDecompression()
+{
+  try {
+    std::unique_ptr<Decoder> decoder;
+    switch(format_) {
+      case CompressionFormat::Gzip:
+        decoder = std::make_unique<GzipDecoder>();
+        break;
+      case CompressionFormat::Zstd:
+        decoder = std::make_unique<ZstdDecoder>();
+        break;
+    }
+    auto input = compressed_data_;
+    while(true) {
+      auto block = std::make_shared<std::vector<uint8_t>>(kBlockSize);
+      std::size_t block_size = 0;
+      std::exception_ptr decode_error;
+      try {
+        while(block_size < kBlockSize) {
+          const auto input_size_before = input.size();
+          const auto bytes_produced =
+            decoder->Decode(input, std::span<uint8_t>(*block).subspan(block_size));
+          block_size += bytes_produced;
+          input_bytes_consumed_ = compressed_data_.size() - input.size();
+          if(bytes_produced == 0 && input.size() == input_size_before) {
+            // No progress is possible, so either the input is used up or it is garbage
+            if(!input.empty()) {
+              throw std::runtime_error("Compressed log is corrupt.");
+            }
+            break;
+          }
+        }
+      } catch (const std::exception &) {
+        // The entries decoded before the corruption are still good
+        decode_error = std::current_exception();
+      }
+      if(block_size > 0) {
+        block->resize(block_size);
+        if(!PushBlock(std::move(block))) {
+          return;
+        }
+      }
+      if(decode_error) {
+        std::rethrow_exception(decode_error);
+      }
+      if(block_size == 0) {
+        break;
+      }
+    }
+    decoder->CheckFinished();
+  } catch (const std::exception & e) {
+    std::lock_guard lock(mutex_);
+    error_ = e.what();
+  }
+  {
+    std::lock_guard lock(mutex_);
+    finished_ = true;
+  }
+  condition_.notify_all();
+}
+
+bool DecompressingSource::PushBlock(Block block)
+{
+  std::unique_lock lock(mutex_);
+  condition_.wait(
+    lock, [this]() {
+      return stopping_ || ready_blocks_.size() < kMaxReadyBlocks;
+    });
+  if(stopping_) {
+    return false;
+  }
+  ready_blocks_.push_back(std::move(block));
+  condition_.notify_all();
+  return true;
+}
+
+}  // namespace ssl_ros_bridge::core
@@ -0,0 +1,96 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef CORE__DECOMPRESSING_SOURCE_HPP_
+#define CORE__DECOMPRESSING_SOURCE_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <thread>
+
+#include "byte_source.hpp"
+
+namespace ssl_ros_bridge::core
+{
+
+enum class CompressionFormat
+{
+  Gzip,
+  Zstd
+};
+
+/**
+ * Identifies compressed input by its magic bytes. Returns nullopt for uncompressed data.
+ */
+std::optional<CompressionFormat> DetectCompression(std::span<const uint8_t> data);
+
+/**
+ * Decompresses a gzip or zstd log on a background thread.
+ *
+ * The thread keeps at most two decompressed blocks ready, so it fills one while the reader parses
+ * the other.
+ */
+class DecompressingSource : public ByteSource {
+public:
+  /**
+   * @param compressed_data Entire compressed file, which must outlive this source
+   */
+  DecompressingSource(std::span<const uint8_t> compressed_data, const CompressionFormat format);
+
+  ~DecompressingSource() override;
+
+  Block ReadBlock() override;
+
+  double GetProgress() const override;
+
+private:
+  static constexpr std::size_t kBlockSize = 4 << 20;
+  static constexpr std::size_t kMaxReadyBlocks = 2;
+
+  std::span<const uint8_t> compressed_data_;
+  const CompressionFormat format_;
+  std::atomic_size_t input_bytes_consumed_{0};
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::deque<Block> ready_blocks_;
+  bool finished_{false};
+  bool stopping_{false};
+  std::string error_;
+  std::thread decompression_thread_;
+
+  void RunDecompression();
+
+  /**
+   * Hands a block to the reader, waiting while two are already ready.
+   *
+   * @return False if the source is being destroyed
+   */
+  bool PushBlock(Block block);
+};
+
+}  // namespace ssl_ros_bridge::core
+
+#endif  // CORE__DECOMPRESSING_SOURCE_HPP_
@@ -0,0 +1,217 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "following_file_source.hpp"
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "log_format.hpp"
+#include "log_reader.hpp"
+
+namespace ssl_ros_bridge::core
+{
+
+using log_format::kEntryHeaderSize;
+using log_format::kFileHeaderSize;
+using log_format::kIndexTrailerSize;
+using log_format::ReadBigEndian;
+
+FollowingFileSource::FollowingFileSource(
+  const std::filesystem::path & path,
+  std::chrono::milliseconds idle_timeout)
+: idle_timeout_(idle_timeout),
+  last_growth_time_(std::chrono::steady_clock::now())
+{
+  file_descriptor_ = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if(file_descriptor_ < 0) {
+    throw std::runtime_error("Could not open " + path.string() + ": " + std::strerror(errno));
+  }
+  inotify_descriptor_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  // Appends raise IN_MODIFY, and deleting the file raises IN_ATTRIB as its link count drops
+  if(inotify_descriptor_ < 0 ||
+    inotify_add_watch(inotify_descriptor_, path.c_str(), IN_MODIFY | IN_ATTRIB) < 0)
+  {
+    const auto error = errno;
+    CloseDescriptors();
+    throw std::runtime_error("Could not watch " + path.string() + ": " + std::strerror(error));
+  }
+  stop_descriptor_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if(stop_descriptor_ < 0) {
+    const auto error = errno;
+    CloseDescriptors();
+    throw std::runtime_error(std::string("Could not create an eventfd: ") + std::strerror(error));
+  }
+}
+
+FollowingFileSource::~FollowingFileSource()
+{
+  CloseDescriptors();
+}
+
+ByteSource::Block FollowingFileSource::ReadBlock()
+{
+  while(!stopped_) {
+    struct stat file_status;
+    if(fstat(file_descriptor_, &file_status) != 0) {
+      throw std::runtime_error(
+              std::string("Could not stat the followed log: ") + std::strerror(errno));
+    }
+    const auto file_size = static_cast<uint64_t>(file_status.st_size);
+    if(file_size < bytes_read_) {
+      throw std::runtime_error("The followed log was truncated.");
+    }
+    file_size_ = file_size;
+    if(file_size > bytes_read_) {
+      // Hand over whatever has been written instead of waiting for a full block, so entries reach
+      // the reader as soon as possible
+      auto block = std::make_shared<std::vector<uint8_t>>(
+        std::min<uint64_t>(file_size - bytes_read_, kMaxBlockSize));
+      const auto count = read(file_descriptor_, block->data(), block->size());
+      if(count < 0) {
+        if(errno == EINTR) {
+          continue;
+        }
+        throw std::runtime_error(
+                std::string("Could not read the followed log: ") + std::strerror(errno));
+      }
+      if(count > 0) {
+        block->resize(count);
+        bytes_read_ += count;
+        last_growth_time_ = std::chrono::steady_clock::now();
+        return block;
+      }
+      continue;
+    }
+    if(HasIndexTrailer() || file_status.st_nlink == 0) {
+      return nullptr;
+    }
+    if(!WaitForChange()) {
+      return nullptr;
+    }
+  }
+  return nullptr;
+}
+
+double FollowingFileSource::GetProgress() const
+{
+  const auto file_size = file_size_.load();
+  if(file_size == 0) {
+    return 0.0;
+  }
+  return static_cast<double>(bytes_read_) / file_size;
+}
+
+void FollowingFileSource::Stop()
+{
+  stopped_ = true;
+  const uint64_t value = 1;
+  // Fails only if the counter would overflow, in which case the wait is already interrupted
+  [[maybe_unused]] const auto result = write(stop_descriptor_, &value, sizeof(value));
+}
+
+bool FollowingFileSource::HasIndexTrailer() const
+{
+  const auto file_size = file_size_.load();
+  if(file_size < kFileHeaderSize + kEntryHeaderSize + kIndexTrailerSize) {
+    return false;
+  }
+  const auto trailer_offset = file_size - kIndexTrailerSize;
+  std::array<uint8_t, kIndexTrailerSize> trailer;
+  if(pread(file_descriptor_, trailer.data(), trailer.size(), trailer_offset) !=
+    static_cast<ssize_t>(trailer.size()))
+  {
+    return false;
+  }
+  if(!std::ranges::equal(
+      std::span(trailer).last(log_format::kIndexMarker.size()), log_format::kIndexMarker))
+  {
+    return false;
+  }
+  // The marker could also be the end of a payload, so check that an index entry fills the space
+  // before it
+  const auto index_offset = ReadBigEndian<int64_t>(trailer.data());
+  if(index_offset < static_cast<int64_t>(kFileHeaderSize) ||
+    static_cast<uint64_t>(index_offset) + kEntryHeaderSize > trailer_offset)
+  {
+    return false;
+  }
+  std::array<uint8_t, kEntryHeaderSize> index_header;
+  if(pread(file_descriptor_, index_header.data(), index_header.size(), index_offset) !=
+    static_cast<ssize_t>(index_header.size()))
+  {
+    return false;
+  }
+  const auto entry_type = ReadBigEndian<int32_t>(index_header.data() + 8);
+  const auto payload_size = ReadBigEndian<int32_t>(index_header.data() + 12);
+  return entry_type == static_cast<int32_t>(EntryType::Index2021) && payload_size >= 0 &&
+         index_offset + kEntryHeaderSize + payload_size == trailer_offset;
+}
+
+bool FollowingFileSource::WaitForChange()
+{
+  int timeout_ms = -1;
+  if(idle_timeout_ > std::chrono::milliseconds::zero()) {
+    const auto idle_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - last_growth_time_);
+    if(idle_time >= idle_timeout_) {
+      return false;
+    }
+    timeout_ms = static_cast<int>((idle_timeout_ - idle_time).count());
+  }
+  std::array<pollfd, 2> descriptors = {{
+    {inotify_descriptor_, POLLIN, 0},
+    {stop_descriptor_, POLLIN, 0}
+  }};
+  if(poll(descriptors.data(), descriptors.size(), timeout_ms) < 0 && errno != EINTR) {
+    throw std::runtime_error(
+            std::string("Could not wait for the followed log: ") + std::strerror(errno));
+  }
+  if(descriptors[1].revents != 0) {
+    return false;
+  }
+  // The file is checked again after waking, so the events themselves are not needed
+  alignas(inotify_event) std::array<char, 4096> events;
+  while(read(inotify_descriptor_, events.data(), events.size()) > 0) {
+  }
+  // A timeout is caught by the idle check of the next wait
+  return true;
+}
+
+void FollowingFileSource::CloseDescriptors()
+{
+  for(const auto descriptor : {file_descriptor_, inotify_descriptor_, stop_descriptor_}) {
+    if(descriptor >= 0) {
+      close(descriptor);
+    }
+  }
+}
+
+}  // namespace ssl_ros_bridge::core
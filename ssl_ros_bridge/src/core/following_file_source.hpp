@@ -0,0 +1,102 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef CORE__FOLLOWING_FILE_SOURCE_HPP_
+#define CORE__FOLLOWING_FILE_SOURCE_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+
+#include "byte_source.hpp"
+
+namespace ssl_ros_bridge::core
+{
+
+/**
+ * Reads a log file which another process is still writing, like tail -f.
+ *
+ * Once the bytes written so far are consumed, ReadBlock() sleeps on inotify until the file grows.
+ * Entries cut off at the end of the file are completed by LogReader when the rest arrives. The log
+ * ends when the writer appends an index, when the file is deleted, after idle_timeout without
+ * growth, or when Stop() is called.
+ */
+class FollowingFileSource : public ByteSource {
+public:
+  /**
+   * @param idle_timeout How long the file may stop growing before the log ends. Zero waits forever.
+   * @throws std::runtime_error if the file cannot be opened or watched
+   */
+  explicit FollowingFileSource(
+    const std::filesystem::path & path,
+    std::chrono::milliseconds idle_timeout = std::chrono::milliseconds::zero());
+
+  ~FollowingFileSource() override;
+
+  FollowingFileSource(const FollowingFileSource &) = delete;
+  FollowingFileSource & operator=(const FollowingFileSource &) = delete;
+
+  /**
+   * Returns the next bytes written to the file, waiting for them if necessary.
+   *
+   * @throws std::runtime_error if the file is truncated or cannot be read
+   */
+  Block ReadBlock() override;
+
+  /**
+   * Returns the fraction of the bytes written so far which have been read.
+   */
+  double GetProgress() const override;
+
+  /**
+   * Ends the log, waking ReadBlock() if it is waiting. Safe to call from any thread.
+   */
+  void Stop();
+
+private:
+  static constexpr std::size_t kMaxBlockSize = 1 << 20;
+
+  int file_descriptor_{-1};
+  int inotify_descriptor_{-1};
+  // Written by Stop() to interrupt the wait
+  int stop_descriptor_{-1};
+  const std::chrono::milliseconds idle_timeout_;
+  std::atomic_uint64_t bytes_read_{0};
+  std::atomic_uint64_t file_size_{0};
+  std::atomic_bool stopped_{false};
+  std::chrono::steady_clock::time_point last_growth_time_;
+
+  /**
+   * True if the file ends with the index which writers append when they close a log.
+   */
+  bool HasIndexTrailer() const;
+
+  /**
+   * Sleeps until the file changes. Returns false if the idle timeout passed or Stop() was called.
+   */
+  bool WaitForChange();
+
+  void CloseDescriptors();
+};
+
+}  // namespace ssl_ros_bridge::core
+
+#endif  // CORE__FOLLOWING_FILE_SOURCE_HPP_
@@ -0,0 +1,116 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ssl_ros_bridge::core
+{
+
+Histogram::Histogram(const double bucket_width, const std::size_t bucket_count)
+: bucket_width_(bucket_width),
+  buckets_(bucket_count + 1, 0)
+{
+}
+
+void Histogram::AddSample(const double value)
+{
+  const auto clamped_value = std::max(value, 0.0);
+  const auto bucket_index = std::min(
+    static_cast<std::size_t>(clamped_value / bucket_width_), buckets_.size() - 1);
+  buckets_[bucket_index]++;
+  if (sample_count_ == 0) {
+    min_ = value;
+    max_ = value;
+  } else {
+    min_ = std::min(min_, value);
+    max_ = std::max(max_, value);
+  }
+  sum_ += value;
+  sample_count_++;
+}
+
+void Histogram::Reset()
+{
+  std::fill(buckets_.begin(), buckets_.end(), 0);
+  sample_count_ = 0;
+  sum_ = 0.0;
+  min_ = 0.0;
+  max_ = 0.0;
+}
+
+void Histogram::Merge(const Histogram & other)
+{
+  if (other.sample_count_ == 0) {
+    return;
+  }
+  const auto bucket_count = std::min(buckets_.size(), other.buckets_.size());
+  for (std::size_t i = 0; i < bucket_count; ++i) {
+    buckets_[i] += other.buckets_[i];
+  }
+  if (sample_count_ == 0) {
+    min_ = other.min_;
+    max_ = other.max_;
+  } else {
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+  }
+  sum_ += other.sum_;
+  sample_count_ += other.sample_count_;
+}
+
+double Histogram::GetMean() const
+{
+  if (sample_count_ == 0) {
+    return 0.0;
+  }
+  return sum_ / sample_count_;
+}
+
+double Histogram::GetMin() const
+{
+  return min_;
+}
+
+double Histogram::GetMax() const
+{
+  return max_;
+}
+
+double Histogram::GetPercentile(const double fraction) const
+{
+  if (sample_count_ == 0) {
+    return 0.0;
+  }
+  const auto target_rank = static_cast<uint64_t>(
+    std::ceil(std::clamp(fraction, 0.0, 1.0) * sample_count_));
+  uint64_t cumulative_count = 0;
+  for (std::size_t i = 0; i < buckets_.size() - 1; ++i) {
+    cumulative_count += buckets_[i];
+    if (cumulative_count >= target_rank && cumulative_count > 0) {
+      return std::min((i + 1) * bucket_width_, max_);
+    }
+  }
+  return max_;
+}
+
+}  // namespace ssl_ros_bridge::core
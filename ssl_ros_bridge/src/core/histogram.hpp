@@ -0,0 +1,100 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef CORE__HISTOGRAM_HPP_
+#define CORE__HISTOGRAM_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ssl_ros_bridge::core
+{
+
+/**
+ * Histogram with a fixed number of equal-width buckets starting at zero.
+ *
+ * Samples larger than the last bucket are counted in an extra overflow bucket. Adding a sample
+ * never allocates, so this is safe to use on receive threads.
+ */
+class Histogram
+{
+public:
+  /**
+   * @param bucket_width Width of each bucket, in the same units as the samples
+   * @param bucket_count Number of regular buckets, not including the overflow bucket
+   */
+  Histogram(const double bucket_width, const std::size_t bucket_count);
+
+  void AddSample(const double value);
+
+  void Reset();
+
+  /**
+   * Adds all samples from another histogram with the same bucket width and count.
+   */
+  void Merge(const Histogram & other);
+
+  uint64_t GetSampleCount() const
+  {
+    return sample_count_;
+  }
+
+  double GetMean() const;
+
+  double GetMin() const;
+
+  double GetMax() const;
+
+  /**
+   * Estimates the value below which the given fraction of samples fall.
+   *
+   * The estimate is the upper edge of the bucket containing the requested rank. Ranks landing in
+   * the overflow bucket report the largest sample seen.
+   *
+   * @param fraction Value between 0 and 1 (ie. 0.95 for the 95th percentile)
+   */
+  double GetPercentile(const double fraction) const;
+
+  double GetBucketWidth() const
+  {
+    return bucket_width_;
+  }
+
+  /**
+   * Returns the sample count of each bucket. The last element is the overflow bucket.
+   */
+  const std::vector<uint64_t> & GetBucketCounts() const
+  {
+    return buckets_;
+  }
+
+private:
+  double bucket_width_;
+  std::vector<uint64_t> buckets_;
+  uint64_t sample_count_{0};
+  double sum_{0.0};
+  double min_{0.0};
+  double max_{0.0};
+};
+
+}  // namespace ssl_ros_bridge::core
+
+#endif  // CORE__HISTOGRAM_HPP_
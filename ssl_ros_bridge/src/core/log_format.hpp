@@ -0,0 +1,71 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef CORE__LOG_FORMAT_HPP_
+#define CORE__LOG_FORMAT_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace ssl_ros_bridge::core::log_format
+{
+
+constexpr std::size_t kFileHeaderSize = 16;
+
+/// "SSL_LOG_FILE" followed by the format version, 1, as a big-endian int32
+constexpr std::array<uint8_t, kFileHeaderSize> kFileHeader = {'S', 'S', 'L', '_', 'L', 'O', 'G',
+  '_', 'F', 'I', 'L', 'E', 0, 0, 0, 1};
+
+/// Receive time (int64), entry type (int32), and payload size (int32), all big-endian
+constexpr std::size_t kEntryHeaderSize = 16;
+
+/// Largest payload accepted. Real entries are far smaller, so a bigger size means the log is
+/// corrupt. Streamed logs have no file size to check sizes against.
+constexpr std::size_t kMaxEntrySize = 64 * 1024 * 1024;
+
+/// Indexed logs end with the offset of the index entry followed by this marker
+constexpr std::string_view kIndexMarker = "INDEXED";
+constexpr std::size_t kIndexTrailerSize = sizeof(int64_t) + kIndexMarker.size();
+
+template<typename T>
+T ReadBigEndian(const uint8_t * data)
+{
+  std::make_unsigned_t<T> value = 0;
+  for(std::size_t i = 0; i < sizeof(T); ++i) {
+    value = (value << 8) | data[i];
+  }
+  return static_cast<T>(value);
+}
+
+template<typename T>
+void WriteBigEndian(const T value, uint8_t * data)
+{
+  const auto unsigned_value = static_cast<std::make_unsigned_t<T>>(value);
+  for(std::size_t i = 0; i < sizeof(T); ++i) {
+    data[i] = static_cast<uint8_t>(unsigned_value >> (8 * (sizeof(T) - 1 - i)));
+  }
+}
+
+}  // namespace ssl_ros_bridge::core::log_format
+
+#endif  // CORE__LOG_FORMAT_HPP_
@@ -0,0 +1,143 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "log_index.hpp"
+#include <algorithm>
+#include "log_format.hpp"
+#include "log_reader.hpp"
+
+namespace ssl_ros_bridge::core
+{
+
+using log_format::ReadBigEndian;
+
+LogIndex::LogIndex(std::span<const uint8_t> data)
+: data_(data)
+{
+  if(!LoadFromFile()) {
+    BuildByScanning();
+  }
+}
+
+std::size_t LogIndex::GetEntryOffset(const std::size_t entry_number) const
+{
+  if(entry_number >= offsets_.size()) {
+    return end_offset_;
+  }
+  return offsets_[entry_number];
+}
+
+int64_t LogIndex::GetEntryTime(const std::size_t entry_number) const
+{
+  return ReadBigEndian<int64_t>(data_.data() + offsets_.at(entry_number));
+}
+
+std::size_t LogIndex::FindEntryAtTime(const int64_t time_ns) const
+{
+  const auto entry = std::ranges::lower_bound(
+    offsets_, time_ns, {},
+    [this](const std::size_t offset) {
+      return ReadBigEndian<int64_t>(data_.data() + offset);
+    });
+  return entry - offsets_.begin();
+}
+
+std::optional<std::size_t> LogIndex::FindIndexTrailer(std::span<const uint8_t> data)
+{
+  if(data.size() < log_format::kFileHeaderSize + log_format::kIndexTrailerSize) {
+    return std::nullopt;
+  }
+  const auto trailer_offset = data.size() - log_format::kIndexTrailerSize;
+  const auto marker = data.subspan(trailer_offset + sizeof(int64_t));
+  if(!std::ranges::equal(marker, log_format::kIndexMarker)) {
+    return std::nullopt;
+  }
+  return trailer_offset;
+}
+
+bool LogIndex::LoadFromFile()
+{
+  const auto trailer_offset = FindIndexTrailer(data_);
+  if(!trailer_offset) {
+    return false;
+  }
+  const auto index_offset = ReadBigEndian<int64_t>(data_.data() + *trailer_offset);
+  if(index_offset < static_cast<int64_t>(log_format::kFileHeaderSize) ||
+    static_cast<std::size_t>(index_offset) + log_format::kEntryHeaderSize > *trailer_offset)
+  {
+    return false;
+  }
+  const auto index_header = data_.data() + index_offset;
+  const auto entry_type = ReadBigEndian<int32_t>(index_header + 8);
+  const auto payload_size = ReadBigEndian<int32_t>(index_header + 12);
+  if(entry_type != static_cast<int32_t>(EntryType::Index2021) || payload_size < 0 ||
+    payload_size % sizeof(int64_t) != 0 ||
+    index_offset + log_format::kEntryHeaderSize + payload_size > *trailer_offset)
+  {
+    return false;
+  }
+
+  const auto payload = index_header + log_format::kEntryHeaderSize;
+  const auto offset_count = payload_size / sizeof(int64_t);
+  offsets_.reserve(offset_count);
+  for(std::size_t i = 0; i < offset_count; ++i) {
+    const auto offset = ReadBigEndian<int64_t>(payload + i * sizeof(int64_t));
+    if(offset == index_offset) {
+      // Some writers list the index entry itself
+      continue;
+    }
+    const auto offset_valid = offset >= static_cast<int64_t>(log_format::kFileHeaderSize) &&
+      offset + static_cast<int64_t>(log_format::kEntryHeaderSize) <= index_offset &&
+      (offsets_.empty() || static_cast<std::size_t>(offset) > offsets_.back());
+    if(!offset_valid) {
+      offsets_.clear();
+      return false;
+    }
+    offsets_.push_back(offset);
+  }
+  end_offset_ = index_offset;
+  from_file_ = true;
+  return true;
+}
+
+void LogIndex::BuildByScanning()
+{
+  const auto data_end = FindIndexTrailer(data_).value_or(data_.size());
+  auto offset = log_format::kFileHeaderSize;
+  end_offset_ = offset;
+  while(offset + log_format::kEntryHeaderSize <= data_end) {
+    const auto header = data_.data() + offset;
+    const auto entry_type = ReadBigEndian<int32_t>(header + 8);
+    const auto payload_size = ReadBigEndian<int32_t>(header + 12);
+    if(payload_size < 0 ||
+      offset + log_format::kEntryHeaderSize + payload_size > data_end)
+    {
+      break;
+    }
+    const auto next_offset = offset + log_format::kEntryHeaderSize + payload_size;
+    if(entry_type != static_cast<int32_t>(EntryType::Index2021)) {
+      offsets_.push_back(offset);
+      end_offset_ = next_offset;
+    }
+    offset = next_offset;
+  }
+}
+
+}  // namespace ssl_ros_bridge::core
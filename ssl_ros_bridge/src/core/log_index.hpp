@@ -0,0 +1,91 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef CORE__LOG_INDEX_HPP_
+#define CORE__LOG_INDEX_HPP_
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace ssl_ros_bridge::core
+{
+
+/**
+ * Byte offsets of every entry in an SSL log, for seeking by entry number or receive time.
+ *
+ * Indexed logs carry an Index2021 entry at the end, which is used when it is valid. Otherwise the
+ * index is built by scanning entry headers, which never touches payload bytes. Index2021 entries
+ * themselves are not included.
+ */
+class LogIndex {
+public:
+  /**
+   * @param data Entire contents of the log file, which must outlive the index
+   */
+  explicit LogIndex(std::span<const uint8_t> data);
+
+  /**
+   * True if the index was read from the log rather than built by scanning it.
+   */
+  bool IsFromFile() const
+  {
+    return from_file_;
+  }
+
+  std::size_t GetEntryCount() const
+  {
+    return offsets_.size();
+  }
+
+  /**
+   * Returns the byte offset of an entry from the start of the file. Passing GetEntryCount()
+   * returns the offset just past the last entry.
+   */
+  std::size_t GetEntryOffset(const std::size_t entry_number) const;
+
+  int64_t GetEntryTime(const std::size_t entry_number) const;
+
+  /**
+   * Returns the number of the first entry received at or after the given time, or
+   * GetEntryCount() if there is none. Assumes entries are stored in time order.
+   */
+  std::size_t FindEntryAtTime(const int64_t time_ns) const;
+
+  /**
+   * Returns the offset of the Index2021 trailer if the log ends with one.
+   */
+  static std::optional<std::size_t> FindIndexTrailer(std::span<const uint8_t> data);
+
+private:
+  std::span<const uint8_t> data_;
+  std::vector<std::size_t> offsets_;
+  std::size_t end_offset_{0};
+  bool from_file_{false};
+
+  bool LoadFromFile();
+
+  void BuildByScanning();
+};
+
+}  // namespace ssl_ros_bridge::core
+
+#endif  // CORE__LOG_INDEX_HPP_
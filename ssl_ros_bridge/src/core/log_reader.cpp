@@ -0,0 +1,227 @@
+// Copyright 2025 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "log_reader.hpp"
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "log_format.hpp"
+#include "log_index.hpp"
+
+namespace ssl_ros_bridge::core
+{
+
+using log_format::kEntryHeaderSize;
+using log_format::kFileHeaderSize;
+using log_format::ReadBigEndian;
+
+LogReader::LogReader(std::span<const uint8_t> data)
+: data_(data),
+  end_offset_(LogIndex::FindIndexTrailer(data).value_or(data.size()))
+{
+  CheckHeader();
+  entry_type_counts = {
+    {EntryType::Blank, 0},
+    {EntryType::Unknown, 0},
+    {EntryType::Vision2010, 0},
+    {EntryType::Refbox2013, 0},
+    {EntryType::Vision2014, 0},
+    {EntryType::VisionTracker2020, 0},
+    {EntryType::Index2021, 0}
+  };
+}
+
+LogReader::LogReader(std::unique_ptr<ByteSource> source)
+: source_(std::move(source)),
+  end_offset_(std::numeric_limits<std::size_t>::max())
+{
+  CheckHeader();
+  entry_type_counts = {
+    {EntryType::Blank, 0},
+    {EntryType::Unknown, 0},
+    {EntryType::Vision2010, 0},
+    {EntryType::Refbox2013, 0},
+    {EntryType::Vision2014, 0},
+    {EntryType::VisionTracker2020, 0},
+    {EntryType::Index2021, 0}
+  };
+}
+
+std::optional<LogEntry> LogReader::GetNextEntry()
+{
+  while(true) {
+    const auto header = Read(kEntryHeaderSize);
+    if(header.data.empty()) {
+      return std::nullopt;
+    }
+    if(header.data.size() < kEntryHeaderSize) {
+      // Streamed logs still contain the trailer of indexed logs
+      const auto is_index_trailer = header.data.size() == log_format::kIndexTrailerSize &&
+        std::ranges::equal(header.data.last(log_format::kIndexMarker.size()),
+          log_format::kIndexMarker);
+      if(!is_index_trailer) {
+        std::cerr << "Not enough bytes left in log for a valid entry.\n";
+        std::cerr << header.data.size() << '\n';
+      }
+      return std::nullopt;
+    }
+    const auto received_time_ns = ReadBigEndian<int64_t>(header.data.data());
+    const auto entry_type_raw = ReadBigEndian<int32_t>(header.data.data() + 8);
+    const auto data_size = ReadBigEndian<int32_t>(header.data.data() + 12);
+    if(data_size < 0 || static_cast<std::size_t>(data_size) > log_format::kMaxEntrySize) {
+      std::cerr << "Invalid data packet size: " << data_size << ". The log is corrupt.\n";
+      end_offset_ = read_offset_;
+      return std::nullopt;
+    }
+    auto payload = Read(data_size);
+    if(payload.data.size() != static_cast<std::size_t>(data_size)) {
+      std::cerr << "Not enough bytes for expected data packet.\n";
+      std::cerr << payload.data.size() << '\n';
+      return std::nullopt;
+    }
+    if(entry_type_raw < 0 || entry_type_raw > 6) {
+      std::cerr << "Unrecognized entry type: " << entry_type_raw << '\n';
+      continue;
+    }
+    const auto entry_type = static_cast<EntryType>(entry_type_raw);
+    entry_type_counts[entry_type]++;
+    return LogEntry{received_time_ns, entry_type, payload.data, std::move(payload.storage)};
+  }
+}
+
+std::optional<LogEntry> LogReader::GetNextMessage()
+{
+  while(auto entry = GetNextEntry()) {
+    if(entry->type == EntryType::Refbox2013 || entry->type == EntryType::Vision2014) {
+      return entry;
+    }
+  }
+  return std::nullopt;
+}
+
+void LogReader::SeekToOffset(const std::size_t offset)
+{
+  if(!IsSeekable()) {
+    throw std::logic_error("Seeking requires an uncompressed log.");
+  }
+  read_offset_ = std::clamp(offset, kFileHeaderSize, end_offset_);
+  start_offset_ = read_offset_;
+}
+
+void LogReader::SetEndOffset(const std::size_t offset)
+{
+  if(!IsSeekable()) {
+    throw std::logic_error("Seeking requires an uncompressed log.");
+  }
+  end_offset_ = std::clamp(offset, kFileHeaderSize, end_offset_);
+  read_offset_ = std::min(read_offset_, end_offset_);
+  start_offset_ = std::min(start_offset_, end_offset_);
+}
+
+double LogReader::GetProgress() const
+{
+  if(source_) {
+    return source_->GetProgress();
+  }
+  if(end_offset_ <= start_offset_) {
+    return 1.0;
+  }
+  return static_cast<double>(read_offset_ - start_offset_) / (end_offset_ - start_offset_);
+}
+
+void LogReader::CheckHeader()
+{
+  const auto header = Read(kFileHeaderSize);
+  if(header.data.size() < kFileHeaderSize) {
+    std::cout << "Read " << header.data.size() << " bytes.\n";
+    throw std::runtime_error("Not enough bytes for a valid header");
+  }
+  if(!std::ranges::equal(header.data, log_format::kFileHeader)) {
+    throw std::runtime_error("Unsupported file format based on header bytes.");
+  }
+  start_offset_ = read_offset_;
+}
+
+LogReader::Bytes LogReader::Read(const std::size_t size)
+{
+  const auto bytes_available = std::min(size, end_offset_ - read_offset_);
+  if(bytes_available == 0) {
+    return {};
+  }
+  if(source_) {
+    auto bytes = ReadFromSource(bytes_available);
+    read_offset_ += bytes.data.size();
+    return bytes;
+  }
+  const auto data = data_.subspan(read_offset_, bytes_available);
+  read_offset_ += bytes_available;
+  return {data, nullptr};
+}
+
+LogReader::Bytes LogReader::ReadFromSource(const std::size_t size)
+{
+  while(!block_ || block_position_ == block_->size()) {
+    if(!FetchBlock()) {
+      return {};
+    }
+  }
+  if(block_->size() - block_position_ >= size) {
+    const auto data = std::span<const uint8_t>(*block_).subspan(block_position_, size);
+    block_position_ += size;
+    return {data, block_};
+  }
+
+  // The bytes straddle blocks, so gather them into their own buffer
+  auto gathered = std::make_shared<std::vector<uint8_t>>();
+  gathered->reserve(size);
+  while(gathered->size() < size) {
+    if(block_position_ == block_->size() && !FetchBlock()) {
+      break;
+    }
+    const auto bytes_to_copy = std::min(size - gathered->size(), block_->size() - block_position_);
+    const auto block_data = block_->begin() + block_position_;
+    gathered->insert(gathered->end(), block_data, block_data + bytes_to_copy);
+    block_position_ += bytes_to_copy;
+  }
+  return {std::span<const uint8_t>(*gathered), gathered};
+}
+
+bool LogReader::FetchBlock()
+{
+  block_position_ = 0;
+  if(end_of_stream_) {
+    block_ = nullptr;
+    return false;
+  }
+  try {
+    block_ = source_->ReadBlock();
+  } catch (const std::runtime_error & e) {
+    // Keep the entries read so far, as for a truncated uncompressed log
+    std::cerr << e.what() << '\n';
+    block_ = nullptr;
+  }
+  end_of_stream_ = block_ == nullptr;
+  return !end_of_stream_;
+}
+
+}  // namespace ssl_ros_bridge::core
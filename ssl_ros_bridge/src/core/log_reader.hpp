@@ -0,0 +1,167 @@
+// Copyright 2025 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef CORE__LOG_READER_HPP_
+#define CORE__LOG_READER_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include "byte_source.hpp"
+
+namespace ssl_ros_bridge::core
+{
+
+enum class EntryType : int32_t
+{
+  Blank = 0,
+  Unknown = 1,
+  Vision2010 = 2,
+  Refbox2013 = 3,
+  Vision2014 = 4,
+  VisionTracker2020 = 5,
+  Index2021 = 6
+};
+
+/**
+ * A log entry whose payload has not been parsed yet.
+ *
+ * For logs held in memory, the data span points into the buffer given to the LogReader and is
+ * only valid while that buffer is alive. For streamed logs, storage keeps the data alive.
+ */
+struct LogEntry
+{
+  int64_t received_time_ns;
+  EntryType type;
+  std::span<const uint8_t> data;
+  std::shared_ptr<const void> storage;
+};
+
+/**
+ * Walks the entries of an SSL log file without copying or parsing payloads.
+ *
+ * Logs held in memory support seeking. Streamed logs are read front to back, and only entries
+ * which straddle two blocks of the stream are copied.
+ */
+class LogReader {
+public:
+  /**
+   * @param data Entire contents of the log file, such as a MappedFile
+   * @throws std::runtime_error if the file header is missing or unsupported
+   */
+  explicit LogReader(std::span<const uint8_t> data);
+
+  /**
+   * @param source Stream of log bytes, such as a DecompressingSource, or a FollowingFileSource for
+   *   a log which is still being written
+   * @throws std::runtime_error if the file header is missing or unsupported
+   */
+  explicit LogReader(std::unique_ptr<ByteSource> source);
+
+  /**
+   * Returns the next entry of any type, or nullopt at the end of the log.
+   */
+  std::optional<LogEntry> GetNextEntry();
+
+  /**
+   * Returns the next Refbox2013 or Vision2014 entry, or nullopt at the end of the log.
+   */
+  std::optional<LogEntry> GetNextMessage();
+
+  /**
+   * True if the log is held in memory, so SeekToOffset() and SetEndOffset() can be used.
+   */
+  bool IsSeekable() const
+  {
+    return source_ == nullptr;
+  }
+
+  /**
+   * Moves to the entry starting at the given byte offset, such as one from a LogIndex.
+   *
+   * @throws std::logic_error if the log is streamed
+   */
+  void SeekToOffset(const std::size_t offset);
+
+  /**
+   * Stops reading at the given byte offset, which should be an entry boundary.
+   *
+   * @throws std::logic_error if the log is streamed
+   */
+  void SetEndOffset(const std::size_t offset);
+
+  /**
+   * Returns the fraction of the log, or of the range being read, consumed so far.
+   */
+  double GetProgress() const;
+
+  /**
+   * Returns the offset of the next entry, which is the number of bytes read when reading from the
+   * start of the file.
+   */
+  std::size_t GetBytesRead() const
+  {
+    return read_offset_;
+  }
+
+  const std::unordered_map<EntryType, uint64_t> & GetEntryTypeCounts() const
+  {
+    return entry_type_counts;
+  }
+
+private:
+  struct Bytes
+  {
+    std::span<const uint8_t> data;
+    std::shared_ptr<const void> storage;
+  };
+
+  std::span<const uint8_t> data_;
+  std::unique_ptr<ByteSource> source_;
+  ByteSource::Block block_;
+  std::size_t block_position_{0};
+  bool end_of_stream_{false};
+  std::size_t start_offset_{0};
+  std::size_t read_offset_{0};
+  // Excludes the trailer of indexed logs, which is not an entry
+  std::size_t end_offset_;
+  std::unordered_map<EntryType, uint64_t> entry_type_counts;
+
+  void CheckHeader();
+
+  /**
+   * Consumes up to size bytes. Fewer are returned only at the end of the log.
+   */
+  Bytes Read(const std::size_t size);
+
+  Bytes ReadFromSource(const std::size_t size);
+
+  /**
+   * Replaces the current block with the next one from the source. Returns false at the end of the
+   * stream, including when the stream is corrupt.
+   */
+  bool FetchBlock();
+};
+
+}  // namespace ssl_ros_bridge::core
+
+#endif  // CORE__LOG_READER_HPP_
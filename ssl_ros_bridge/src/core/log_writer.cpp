@@ -0,0 +1,221 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "log_writer.hpp"
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include "log_format.hpp"
+
+namespace ssl_ros_bridge::core
+{
+
+using log_format::kEntryHeaderSize;
+using log_format::WriteBigEndian;
+
+LogWriter::LogWriter(
+  const std::filesystem::path & path, LogHandler warning_handler,
+  std::size_t max_buffered_bytes, FullBufferPolicy full_buffer_policy)
+: warning_handler_(std::move(warning_handler)),
+  max_buffered_bytes_(max_buffered_bytes),
+  full_buffer_policy_(full_buffer_policy),
+  next_entry_offset_(log_format::kFileHeaderSize)
+{
+  if(warning_handler_ == nullptr) {
+    warning_handler_ = [](const std::string & message) {
+        std::cerr << "WARNING: " << message << std::endl;
+      };
+  }
+  file_descriptor_ = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if(file_descriptor_ < 0) {
+    throw std::runtime_error("Could not create " + path.string() + ": " + std::strerror(errno));
+  }
+  if(!WriteToFile(log_format::kFileHeader)) {
+    close(file_descriptor_);
+    throw std::runtime_error("Could not write the header of " + path.string());
+  }
+  buffer_.reserve(2 * kFlushSize);
+  writer_thread_ = std::thread(&LogWriter::WriterLoop, this);
+}
+
+LogWriter::~LogWriter()
+{
+  Close();
+}
+
+bool LogWriter::Write(
+  const int64_t received_time_ns, const EntryType type,
+  std::span<const uint8_t> data)
+{
+  if(data.size() > static_cast<std::size_t>(std::numeric_limits<int32_t>::max())) {
+    return false;
+  }
+  const auto entry_size = kEntryHeaderSize + data.size();
+  std::unique_lock lock(mutex_);
+  const auto has_space = [&]() {
+      // An empty buffer always accepts an entry, even one larger than the limit
+      return buffer_.size() + bytes_in_flight_ + entry_size <= max_buffered_bytes_ ||
+             (buffer_.empty() && bytes_in_flight_ == 0);
+    };
+  if(full_buffer_policy_ == FullBufferPolicy::Wait && !has_space()) {
+    waiting_writers_++;
+    condition_.notify_one();
+    space_condition_.wait(
+      lock, [&]() {
+        return closing_ || failed_ || has_space();
+      });
+    waiting_writers_--;
+  }
+  if(closing_ || failed_ || !has_space()) {
+    dropped_entry_count_++;
+    return false;
+  }
+  const auto header_offset = buffer_.size();
+  buffer_.resize(header_offset + kEntryHeaderSize);
+  WriteBigEndian<int64_t>(received_time_ns, buffer_.data() + header_offset);
+  WriteBigEndian<int32_t>(static_cast<int32_t>(type), buffer_.data() + header_offset + 8);
+  WriteBigEndian<int32_t>(data.size(), buffer_.data() + header_offset + 12);
+  buffer_.insert(buffer_.end(), data.begin(), data.end());
+  entry_offsets_.push_back(next_entry_offset_);
+  next_entry_offset_ += entry_size;
+  last_received_time_ns_ = received_time_ns;
+  // Only wake the writer thread once there is enough for a large write
+  if(buffer_.size() >= kFlushSize && buffer_.size() - entry_size < kFlushSize) {
+    condition_.notify_one();
+  }
+  return true;
+}
+
+void LogWriter::Close()
+{
+  {
+    std::lock_guard lock(mutex_);
+    if(closing_) {
+      return;
+    }
+    closing_ = true;
+  }
+  condition_.notify_one();
+  space_condition_.notify_all();
+  writer_thread_.join();
+  if(!failed_) {
+    WriteIndex();
+  }
+  close(file_descriptor_);
+  file_descriptor_ = -1;
+}
+
+uint64_t LogWriter::GetEntryCount() const
+{
+  std::lock_guard lock(mutex_);
+  return entry_offsets_.size();
+}
+
+uint64_t LogWriter::GetDroppedEntryCount() const
+{
+  std::lock_guard lock(mutex_);
+  return dropped_entry_count_;
+}
+
+void LogWriter::WriterLoop()
+{
+  std::vector<uint8_t> writing_buffer;
+  writing_buffer.reserve(2 * kFlushSize);
+  std::unique_lock lock(mutex_);
+  while(true) {
+    // Flush periodically as well, so little is lost if the process dies
+    condition_.wait_for(
+      lock, kFlushPeriod, [this]() {
+        // A blocked writer needs the space now, even if the buffer is smaller than kFlushSize
+        return closing_ || buffer_.size() >= kFlushSize ||
+               (waiting_writers_ > 0 && !buffer_.empty());
+      });
+    if(buffer_.empty()) {
+      if(closing_) {
+        return;
+      }
+      continue;
+    }
+    std::swap(buffer_, writing_buffer);
+    bytes_in_flight_ = writing_buffer.size();
+    lock.unlock();
+    const auto written = WriteToFile(writing_buffer);
+    writing_buffer.clear();
+    lock.lock();
+    bytes_in_flight_ = 0;
+    if(!written) {
+      failed_ = true;
+      buffer_.clear();
+    }
+    space_condition_.notify_all();
+    if(failed_) {
+      return;
+    }
+  }
+}
+
+void LogWriter::WriteIndex()
+{
+  // No other thread touches the file or the offsets once the writer is closing
+  const auto index_offset = static_cast<int64_t>(next_entry_offset_);
+  const auto payload_size = entry_offsets_.size() * sizeof(int64_t);
+  if(payload_size > static_cast<std::size_t>(std::numeric_limits<int32_t>::max())) {
+    warning_handler_("Too many log entries to write an index.");
+    return;
+  }
+  std::vector<uint8_t> index(kEntryHeaderSize + payload_size + log_format::kIndexTrailerSize);
+  WriteBigEndian<int64_t>(last_received_time_ns_, index.data());
+  WriteBigEndian<int32_t>(static_cast<int32_t>(EntryType::Index2021), index.data() + 8);
+  WriteBigEndian<int32_t>(payload_size, index.data() + 12);
+  auto position = index.data() + kEntryHeaderSize;
+  for(const auto offset : entry_offsets_) {
+    WriteBigEndian<int64_t>(offset, position);
+    position += sizeof(int64_t);
+  }
+  WriteBigEndian<int64_t>(index_offset, position);
+  std::copy(
+    log_format::kIndexMarker.begin(), log_format::kIndexMarker.end(),
+    position + sizeof(int64_t));
+  WriteToFile(index);
+}
+
+bool LogWriter::WriteToFile(std::span<const uint8_t> data)
+{
+  while(!data.empty()) {
+    const auto bytes_written = write(file_descriptor_, data.data(), data.size());
+    if(bytes_written < 0) {
+      if(errno == EINTR) {
+        continue;
+      }
+      warning_handler_(std::string("Failed to write log: ") + std::strerror(errno));
+      return false;
+    }
+    data = data.subspan(bytes_written);
+  }
+  return true;
+}
+
+}  // namespace ssl_ros_bridge::core
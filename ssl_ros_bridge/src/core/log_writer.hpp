@@ -0,0 +1,132 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef CORE__LOG_WRITER_HPP_
+#define CORE__LOG_WRITER_HPP_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+#include "log_reader.hpp"
+
+namespace ssl_ros_bridge::core
+{
+
+/**
+ * Writes entries to an SSL log file on a dedicated thread.
+ *
+ * Entries are copied into a memory buffer which the writer thread flushes in large writes, so
+ * callers never wait for the disk. Closing the writer appends an Index2021 entry, so the log can
+ * be seeked with LogIndex.
+ */
+class LogWriter
+{
+public:
+  using LogHandler =
+    std::function<void (const std::string & message)>;
+
+  /**
+   * What Write() does while the buffer is full. Live recordings drop entries so the receive
+   * threads never stall, while offline conversions wait for the disk.
+   */
+  enum class FullBufferPolicy
+  {
+    Drop,
+    Wait
+  };
+
+  /**
+   * @param path File to create. An existing file is replaced.
+   * @param warning_handler Called from the writer thread if writing fails
+   * @param max_buffered_bytes Most bytes which may be waiting to be written
+   * @throws std::runtime_error if the file cannot be created
+   */
+  explicit LogWriter(
+    const std::filesystem::path & path, LogHandler warning_handler = nullptr,
+    std::size_t max_buffered_bytes = 64 << 20,
+    FullBufferPolicy full_buffer_policy = FullBufferPolicy::Drop);
+
+  ~LogWriter();
+
+  LogWriter(const LogWriter &) = delete;
+  LogWriter & operator=(const LogWriter &) = delete;
+
+  /**
+   * Queues an entry for writing. Safe to call from any thread.
+   *
+   * @return false if the entry was dropped because the buffer is full, the writer is closed, or
+   *   writing failed
+   */
+  bool Write(int64_t received_time_ns, EntryType type, std::span<const uint8_t> data);
+
+  /**
+   * Writes all queued entries followed by the index, then closes the file.
+   */
+  void Close();
+
+  uint64_t GetEntryCount() const;
+
+  uint64_t GetDroppedEntryCount() const;
+
+private:
+  static constexpr std::size_t kFlushSize = 256 << 10;
+  static constexpr std::chrono::milliseconds kFlushPeriod{100};
+
+  int file_descriptor_{-1};
+  LogHandler warning_handler_;
+  const std::size_t max_buffered_bytes_;
+  const FullBufferPolicy full_buffer_policy_;
+  mutable std::mutex mutex_;
+  std::condition_variable condition_;
+  // Signalled when the writer thread frees buffer space
+  std::condition_variable space_condition_;
+  std::vector<uint8_t> buffer_;
+  // Bytes handed to the writer thread but not yet written
+  std::size_t bytes_in_flight_{0};
+  // Writers blocked until the writer thread frees buffer space
+  std::size_t waiting_writers_{0};
+  std::vector<int64_t> entry_offsets_;
+  std::size_t next_entry_offset_;
+  int64_t last_received_time_ns_{0};
+  uint64_t dropped_entry_count_{0};
+  bool closing_{false};
+  bool failed_{false};
+  std::thread writer_thread_;
+
+  void WriterLoop();
+
+  void WriteIndex();
+
+  /**
+   * Writes all of data to the file, unless writing fails.
+   */
+  bool WriteToFile(std::span<const uint8_t> data);
+};
+
+}  // namespace ssl_ros_bridge::core
+
+#endif  // CORE__LOG_WRITER_HPP_
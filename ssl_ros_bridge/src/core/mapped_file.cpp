@@ -0,0 +1,71 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "mapped_file.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace ssl_ros_bridge::core
+{
+
+MappedFile::MappedFile(const std::filesystem::path & path)
+{
+  const auto file_descriptor = open(path.c_str(), O_RDONLY);
+  if(file_descriptor < 0) {
+    throw std::runtime_error("Could not open " + path.string() + ": " + std::strerror(errno));
+  }
+  struct stat file_status;
+  if(fstat(file_descriptor, &file_status) != 0) {
+    const auto error = errno;
+    close(file_descriptor);
+    throw std::runtime_error("Could not stat " + path.string() + ": " + std::strerror(error));
+  }
+  size_ = file_status.st_size;
+  if(size_ == 0) {
+    // mmap rejects empty mappings
+    close(file_descriptor);
+    return;
+  }
+  void * mapping = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+  const auto error = errno;
+  // The mapping keeps its own reference to the file
+  close(file_descriptor);
+  if(mapping == MAP_FAILED) {
+    throw std::runtime_error("Could not map " + path.string() + ": " + std::strerror(error));
+  }
+  // Entries are read front to back, so let the kernel read ahead aggressively
+  madvise(mapping, size_, MADV_SEQUENTIAL);
+  data_ = static_cast<const uint8_t *>(mapping);
+}
+
+MappedFile::~MappedFile()
+{
+  if(data_ != nullptr) {
+    munmap(const_cast<uint8_t *>(data_), size_);
+  }
+}
+
+}  // namespace ssl_ros_bridge::core
@@ -0,0 +1,61 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef CORE__MAPPED_FILE_HPP_
+#define CORE__MAPPED_FILE_HPP_
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+namespace ssl_ros_bridge::core
+{
+
+/**
+ * Read-only memory mapping of a whole file.
+ *
+ * Pages are loaded by the kernel as they are touched, so large files can be scanned without
+ * copying them into user buffers.
+ */
+class MappedFile {
+public:
+  /**
+   * @throws std::runtime_error if the file cannot be opened or mapped
+   */
+  explicit MappedFile(const std::filesystem::path & path);
+
+  ~MappedFile();
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile & operator=(const MappedFile &) = delete;
+
+  std::span<const uint8_t> GetData() const
+  {
+    return {data_, size_};
+  }
+
+private:
+  const uint8_t * data_{nullptr};
+  std::size_t size_{0};
+};
+
+}  // namespace ssl_ros_bridge::core
+
+#endif  // CORE__MAPPED_FILE_HPP_
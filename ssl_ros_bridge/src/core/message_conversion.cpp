@@ -20,7 +20,10 @@
 
 #include "message_conversion.hpp"
 #include <tf2/LinearMath/Quaternion.h>
+#include <tf2/utils.h>
 #include <algorithm>
+#include <cmath>
+#include <type_traits>
 #include <rclcpp/time.hpp>
 #include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
 
@@ -41,7 +44,25 @@
     }; \
   }
 
+#define CopyOptionalToProto(ros_msg, proto_msg, var_name) \
+  if (!ros_msg.var_name.empty()) { \
+    proto_msg.set_ ## var_name(ros_msg.var_name.front()); \
+  }
+
+#define CopyOptionalStructToProto(ros_msg, proto_msg, var_name) \
+  if (!ros_msg.var_name.empty()) { \
+    *proto_msg.mutable_ ## var_name() = toProto(ros_msg.var_name.front()); \
+  }
+
+#define CopyOptionalEnumToProto(ros_msg, proto_msg, var_name) \
+  if (!ros_msg.var_name.empty()) { \
+    proto_msg.set_ ## var_name( \
+      static_cast<std::remove_cvref_t<decltype(proto_msg.var_name())>>( \
+        ros_msg.var_name.front())); \
+  }
+
 constexpr float mmTom = 1.0e-3f;
+constexpr float mToMm = 1.0e3f;
 constexpr int secToNanosec = 1e9;
 
 namespace ssl_ros_bridge::message_conversion
@@ -725,4 +746,760 @@ ssl_league_msgs::msg::VisionWrapper fromProto(const SSL_WrapperPacket & proto_ms
   return ros_msg;
 }
 
+ssl_league_msgs::msg::SimulatorError fromProto(const SimulatorError & proto_msg)
+{
+  ssl_league_msgs::msg::SimulatorError ros_msg;
+  CopyOptional(proto_msg, ros_msg, code);
+  CopyOptional(proto_msg, ros_msg, message);
+
+  return ros_msg;
+}
+
+ssl_league_msgs::msg::RobotFeedback fromProto(const RobotFeedback & proto_msg)
+{
+  ssl_league_msgs::msg::RobotFeedback ros_msg;
+  ros_msg.id = proto_msg.id();
+  CopyOptional(proto_msg, ros_msg, dribbler_ball_contact);
+
+  return ros_msg;
+}
+
+ssl_league_msgs::msg::RobotControlResponse fromProto(const RobotControlResponse & proto_msg)
+{
+  ssl_league_msgs::msg::RobotControlResponse ros_msg;
+  std::transform(
+    proto_msg.errors().begin(), proto_msg.errors().end(),
+    std::back_inserter(ros_msg.errors),
+    [](const auto & p) {return fromProto(p);});
+  std::transform(
+    proto_msg.feedback().begin(), proto_msg.feedback().end(),
+    std::back_inserter(ros_msg.feedback),
+    [](const auto & p) {return fromProto(p);});
+
+  return ros_msg;
+}
+
+Vector2 toProto(const geometry_msgs::msg::Point32 & ros_msg)
+{
+  Vector2 proto_msg;
+  proto_msg.set_x(ros_msg.x);
+  proto_msg.set_y(ros_msg.y);
+  return proto_msg;
+}
+
+Referee toProto(const ssl_league_msgs::msg::Referee & ros_msg)
+{
+  Referee proto_msg;
+  CopyOptionalToProto(ros_msg, proto_msg, source_identifier);
+  CopyOptionalEnumToProto(ros_msg, proto_msg, match_type);
+  proto_msg.set_packet_timestamp(rclcpp::Time(ros_msg.timestamp).nanoseconds() / 1000);
+  proto_msg.set_stage(static_cast<Referee::Stage>(ros_msg.stage));
+  CopyOptionalToProto(ros_msg, proto_msg, stage_time_left);
+  proto_msg.set_command(static_cast<Referee::Command>(ros_msg.command));
+  proto_msg.set_command_counter(ros_msg.command_counter);
+  proto_msg.set_command_timestamp(
+    rclcpp::Time(ros_msg.command_timestamp).nanoseconds() / 1000);
+  *proto_msg.mutable_yellow() = toProto(ros_msg.yellow);
+  *proto_msg.mutable_blue() = toProto(ros_msg.blue);
+  if (!ros_msg.designated_position.empty()) {
+    const auto & p = ros_msg.designated_position.front();
+    proto_msg.mutable_designated_position()->set_x(p.x * mToMm);
+    proto_msg.mutable_designated_position()->set_y(p.y * mToMm);
+  }
+  CopyOptionalToProto(ros_msg, proto_msg, blue_team_on_positive_half);
+  CopyOptionalEnumToProto(ros_msg, proto_msg, next_command);
+  for (const auto & game_event : ros_msg.game_events) {
+    *proto_msg.add_game_events() = toProto(game_event);
+  }
+  for (const auto & proposal : ros_msg.game_event_proposals) {
+    *proto_msg.add_game_event_proposals() = toProto(proposal);
+  }
+  CopyOptionalToProto(ros_msg, proto_msg, current_action_time_remaining);
+  CopyOptionalToProto(ros_msg, proto_msg, status_message);
+  return proto_msg;
+}
+
+Referee::TeamInfo toProto(const ssl_league_msgs::msg::TeamInfo & ros_msg)
+{
+  Referee::TeamInfo proto_msg;
+  proto_msg.set_name(ros_msg.name);
+  proto_msg.set_score(ros_msg.score);
+  proto_msg.set_red_cards(ros_msg.red_cards);
+  proto_msg.mutable_yellow_card_times()->Add(
+    ros_msg.yellow_card_times.begin(), ros_msg.yellow_card_times.end());
+  proto_msg.set_yellow_cards(ros_msg.yellow_cards);
+  proto_msg.set_timeouts(ros_msg.timeouts);
+  proto_msg.set_timeout_time(ros_msg.timeout_time);
+  proto_msg.set_goalkeeper(ros_msg.goalkeeper);
+  CopyOptionalToProto(ros_msg, proto_msg, foul_counter);
+  CopyOptionalToProto(ros_msg, proto_msg, ball_placement_failures);
+  CopyOptionalToProto(ros_msg, proto_msg, can_place_ball);
+  CopyOptionalToProto(ros_msg, proto_msg, max_allowed_bots);
+  CopyOptionalToProto(ros_msg, proto_msg, bot_substitution_intent);
+  CopyOptionalToProto(ros_msg, proto_msg, ball_placement_failures_reached);
+  CopyOptionalToProto(ros_msg, proto_msg, bot_substitution_allowed);
+  CopyOptionalToProto(ros_msg, proto_msg, bot_substitutions_left);
+  CopyOptionalToProto(ros_msg, proto_msg, bot_substitution_time_left);
+  return proto_msg;
+}
+
+GameEvent toProto(const ssl_league_msgs::msg::GameEvent & ros_msg)
+{
+  GameEvent proto_msg;
+  // fromProto maps a missing id and creation time to empty values
+  if (!ros_msg.id.empty()) {
+    proto_msg.set_id(ros_msg.id);
+  }
+  proto_msg.set_type(static_cast<GameEvent::Type>(ros_msg.type));
+  proto_msg.mutable_origin()->Add(ros_msg.origin.begin(), ros_msg.origin.end());
+  if (ros_msg.created_timestamp != 0) {
+    proto_msg.set_created_timestamp(ros_msg.created_timestamp);
+  }
+  CopyOptionalStructToProto(ros_msg, proto_msg, ball_left_field_touch_line);
+  CopyOptionalStructToProto(ros_msg, proto_msg, ball_left_field_goal_line);
+  CopyOptionalStructToProto(ros_msg, proto_msg, aimless_kick);
+  CopyOptionalStructToProto(ros_msg, proto_msg, attacker_too_close_to_defense_area);
+  CopyOptionalStructToProto(ros_msg, proto_msg, defender_in_defense_area);
+  CopyOptionalStructToProto(ros_msg, proto_msg, boundary_crossing);
+  CopyOptionalStructToProto(ros_msg, proto_msg, keeper_held_ball);
+  CopyOptionalStructToProto(ros_msg, proto_msg, bot_dribbled_ball_too_far);
+  CopyOptionalStructToProto(ros_msg, proto_msg, bot_pushed_bot);
+  CopyOptionalStructToProto(ros_msg, proto_msg, bot_held_ball_deliberately);
+  CopyOptionalStructToProto(ros_msg, proto_msg, bot_tipped_over);
+  CopyOptionalStructToProto(ros_msg, proto_msg, bot_dropped_parts);
+  CopyOptionalStructToProto(ros_msg, proto_msg, attacker_touched_ball_in_defense_area);
+  CopyOptionalStructToProto(ros_msg, proto_msg, bot_kicked_ball_too_fast);
+  CopyOptionalStructToProto(ros_msg, proto_msg, bot_crash_unique);
+  CopyOptionalStructToProto(ros_msg, proto_msg, bot_crash_drawn);
+  CopyOptionalStructToProto(ros_msg, proto_msg, defender_too_close_to_kick_point);
+  CopyOptionalStructToProto(ros_msg, proto_msg, bot_too_fast_in_stop);
+  CopyOptionalStructToProto(ros_msg, proto_msg, bot_interfered_placement);
+  CopyOptionalStructToProto(ros_msg, proto_msg, possible_goal);
+  CopyOptionalStructToProto(ros_msg, proto_msg, goal);
+  CopyOptionalStructToProto(ros_msg, proto_msg, invalid_goal);
+  CopyOptionalStructToProto(ros_msg, proto_msg, attacker_double_touched_ball);
+  CopyOptionalStructToProto(ros_msg, proto_msg, placement_succeeded);
+  CopyOptionalStructToProto(ros_msg, proto_msg, penalty_kick_failed);
+  CopyOptionalStructToProto(ros_msg, proto_msg, no_progress_in_game);
+  CopyOptionalStructToProto(ros_msg, proto_msg, placement_failed);
+  CopyOptionalStructToProto(ros_msg, proto_msg, multiple_cards);
+  CopyOptionalStructToProto(ros_msg, proto_msg, multiple_fouls);
+  CopyOptionalStructToProto(ros_msg, proto_msg, bot_substitution);
+  CopyOptionalStructToProto(ros_msg, proto_msg, excessive_bot_substitution);
+  CopyOptionalStructToProto(ros_msg, proto_msg, too_many_robots);
+  CopyOptionalStructToProto(ros_msg, proto_msg, challenge_flag);
+  CopyOptionalStructToProto(ros_msg, proto_msg, challenge_flag_handled);
+  CopyOptionalStructToProto(ros_msg, proto_msg, emergency_stop);
+  CopyOptionalStructToProto(ros_msg, proto_msg, unsporting_behavior_minor);
+  CopyOptionalStructToProto(ros_msg, proto_msg, unsporting_behavior_major);
+  return proto_msg;
+}
+
+GameEventProposalGroup toProto(const ssl_league_msgs::msg::GameEventProposalGroup & ros_msg)
+{
+  GameEventProposalGroup proto_msg;
+  CopyOptionalToProto(ros_msg, proto_msg, id);
+  for (const auto & game_event : ros_msg.game_events) {
+    *proto_msg.add_game_events() = toProto(game_event);
+  }
+  proto_msg.set_accepted(ros_msg.accepted);
+  return proto_msg;
+}
+
+Division toProto(const ssl_league_msgs::msg::Division & ros_msg)
+{
+  return static_cast<Division>(ros_msg.division);
+}
+
+RobotId toProto(const ssl_league_msgs::msg::RobotId & ros_msg)
+{
+  RobotId proto_msg;
+  if (!ros_msg.team.empty()) {
+    proto_msg.set_team(toProto(ros_msg.team.front()));
+  }
+  CopyOptionalToProto(ros_msg, proto_msg, id);
+  return proto_msg;
+}
+
+Team toProto(const ssl_league_msgs::msg::Team & ros_msg)
+{
+  return static_cast<Team>(ros_msg.color);
+}
+
+GameEvent_AimlessKick toProto(const ssl_league_msgs::msg::AimlessKick & ros_msg)
+{
+  GameEvent_AimlessKick proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  CopyOptionalToProto(ros_msg, proto_msg, by_bot);
+  CopyOptionalStructToProto(ros_msg, proto_msg, location);
+  CopyOptionalStructToProto(ros_msg, proto_msg, kick_location);
+  return proto_msg;
+}
+GameEvent_AttackerDoubleTouchedBall toProto(
+  const ssl_league_msgs::msg::AttackerDoubleTouchedBall & ros_msg)
+{
+  GameEvent_AttackerDoubleTouchedBall proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  CopyOptionalToProto(ros_msg, proto_msg, by_bot);
+  CopyOptionalStructToProto(ros_msg, proto_msg, location);
+  return proto_msg;
+}
+GameEvent_AttackerTooCloseToDefenseArea toProto(
+  const ssl_league_msgs::msg::AttackerTooCloseToDefenseArea & ros_msg)
+{
+  GameEvent_AttackerTooCloseToDefenseArea proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  CopyOptionalToProto(ros_msg, proto_msg, by_bot);
+  CopyOptionalStructToProto(ros_msg, proto_msg, location);
+  CopyOptionalToProto(ros_msg, proto_msg, distance);
+  CopyOptionalStructToProto(ros_msg, proto_msg, ball_location);
+  return proto_msg;
+}
+GameEvent_AttackerTouchedBallInDefenseArea toProto(
+  const ssl_league_msgs::msg::AttackerTouchedBallInDefenseArea & ros_msg)
+{
+  GameEvent_AttackerTouchedBallInDefenseArea proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  CopyOptionalToProto(ros_msg, proto_msg, by_bot);
+  CopyOptionalStructToProto(ros_msg, proto_msg, location);
+  CopyOptionalToProto(ros_msg, proto_msg, distance);
+  return proto_msg;
+}
+GameEvent_AttackerTouchedOpponentInDefenseArea toProto(
+  const ssl_league_msgs::msg::AttackerTouchedOpponentInDefenseArea & ros_msg)
+{
+  GameEvent_AttackerTouchedOpponentInDefenseArea proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  CopyOptionalToProto(ros_msg, proto_msg, by_bot);
+  CopyOptionalToProto(ros_msg, proto_msg, victim);
+  CopyOptionalStructToProto(ros_msg, proto_msg, location);
+  return proto_msg;
+}
+GameEvent_BallLeftField toProto(const ssl_league_msgs::msg::BallLeftField & ros_msg)
+{
+  GameEvent_BallLeftField proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  CopyOptionalToProto(ros_msg, proto_msg, by_bot);
+  CopyOptionalStructToProto(ros_msg, proto_msg, location);
+  return proto_msg;
+}
+GameEvent_BotCrashDrawn toProto(const ssl_league_msgs::msg::BotCrashDrawn & ros_msg)
+{
+  GameEvent_BotCrashDrawn proto_msg;
+  CopyOptionalToProto(ros_msg, proto_msg, bot_yellow);
+  CopyOptionalToProto(ros_msg, proto_msg, bot_blue);
+  CopyOptionalStructToProto(ros_msg, proto_msg, location);
+  CopyOptionalToProto(ros_msg, proto_msg, crash_speed);
+  CopyOptionalToProto(ros_msg, proto_msg, speed_diff);
+  CopyOptionalToProto(ros_msg, proto_msg, crash_angle);
+  return proto_msg;
+}
+GameEvent_BotCrashUnique toProto(const ssl_league_msgs::msg::BotCrashUnique & ros_msg)
+{
+  GameEvent_BotCrashUnique proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  CopyOptionalToProto(ros_msg, proto_msg, violator);
+  CopyOptionalToProto(ros_msg, proto_msg, victim);
+  CopyOptionalStructToProto(ros_msg, proto_msg, location);
+  CopyOptionalToProto(ros_msg, proto_msg, crash_speed);
+  CopyOptionalToProto(ros_msg, proto_msg, speed_diff);
+  CopyOptionalToProto(ros_msg, proto_msg, crash_angle);
+  return proto_msg;
+}
+GameEvent_BotDribbledBallTooFar toProto(const ssl_league_msgs::msg::BotDribbledBallTooFar & ros_msg)
+{
+  GameEvent_BotDribbledBallTooFar proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  CopyOptionalToProto(ros_msg, proto_msg, by_bot);
+  CopyOptionalStructToProto(ros_msg, proto_msg, start);
+  CopyOptionalStructToProto(ros_msg, proto_msg, end);
+  return proto_msg;
+}
+GameEvent_BotHeldBallDeliberately toProto(
+  const ssl_league_msgs::msg::BotHeldBallDeliberately & ros_msg)
+{
+  GameEvent_BotHeldBallDeliberately proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  CopyOptionalToProto(ros_msg, proto_msg, by_bot);
+  CopyOptionalStructToProto(ros_msg, proto_msg, location);
+  CopyOptionalToProto(ros_msg, proto_msg, duration);
+  return proto_msg;
+}
+GameEvent_BotInterferedPlacement toProto(
+  const ssl_league_msgs::msg::BotInterferedPlacement & ros_msg)
+{
+  GameEvent_BotInterferedPlacement proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  CopyOptionalToProto(ros_msg, proto_msg, by_bot);
+  CopyOptionalStructToProto(ros_msg, proto_msg, location);
+  return proto_msg;
+}
+GameEvent_BotKickedBallTooFast toProto(const ssl_league_msgs::msg::BotKickedBallTooFast & ros_msg)
+{
+  GameEvent_BotKickedBallTooFast proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  CopyOptionalToProto(ros_msg, proto_msg, by_bot);
+  CopyOptionalStructToProto(ros_msg, proto_msg, location);
+  CopyOptionalToProto(ros_msg, proto_msg, initial_ball_speed);
+  CopyOptionalToProto(ros_msg, proto_msg, chipped);
+  return proto_msg;
+}
+GameEvent_BotPushedBot toProto(const ssl_league_msgs::msg::BotPushedBot & ros_msg)
+{
+  GameEvent_BotPushedBot proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  CopyOptionalToProto(ros_msg, proto_msg, violator);
+  CopyOptionalToProto(ros_msg, proto_msg, victim);
+  CopyOptionalStructToProto(ros_msg, proto_msg, location);
+  CopyOptionalToProto(ros_msg, proto_msg, pushed_distance);
+  return proto_msg;
+}
+GameEvent_BotSubstitution toProto(const ssl_league_msgs::msg::BotSubstitution & ros_msg)
+{
+  GameEvent_BotSubstitution proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  return proto_msg;
+}
+GameEvent_BotTippedOver toProto(const ssl_league_msgs::msg::BotTippedOver & ros_msg)
+{
+  GameEvent_BotTippedOver proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  CopyOptionalToProto(ros_msg, proto_msg, by_bot);
+  CopyOptionalStructToProto(ros_msg, proto_msg, location);
+  CopyOptionalStructToProto(ros_msg, proto_msg, ball_location);
+  return proto_msg;
+}
+GameEvent_BotTooFastInStop toProto(const ssl_league_msgs::msg::BotTooFastInStop & ros_msg)
+{
+  GameEvent_BotTooFastInStop proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  CopyOptionalToProto(ros_msg, proto_msg, by_bot);
+  CopyOptionalStructToProto(ros_msg, proto_msg, location);
+  CopyOptionalToProto(ros_msg, proto_msg, speed);
+  return proto_msg;
+}
+GameEvent_BoundaryCrossing toProto(const ssl_league_msgs::msg::BoundaryCrossing & ros_msg)
+{
+  GameEvent_BoundaryCrossing proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  CopyOptionalStructToProto(ros_msg, proto_msg, location);
+  return proto_msg;
+}
+GameEvent_ChallengeFlag toProto(const ssl_league_msgs::msg::ChallengeFlag & ros_msg)
+{
+  GameEvent_ChallengeFlag proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  return proto_msg;
+}
+GameEvent_ChippedGoal toProto(const ssl_league_msgs::msg::ChippedGoal & ros_msg)
+{
+  GameEvent_ChippedGoal proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  CopyOptionalToProto(ros_msg, proto_msg, by_bot);
+  CopyOptionalStructToProto(ros_msg, proto_msg, location);
+  CopyOptionalStructToProto(ros_msg, proto_msg, kick_location);
+  CopyOptionalToProto(ros_msg, proto_msg, max_ball_height);
+  return proto_msg;
+}
+GameEvent_DefenderInDefenseArea toProto(const ssl_league_msgs::msg::DefenderInDefenseArea & ros_msg)
+{
+  GameEvent_DefenderInDefenseArea proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  CopyOptionalToProto(ros_msg, proto_msg, by_bot);
+  CopyOptionalStructToProto(ros_msg, proto_msg, location);
+  CopyOptionalToProto(ros_msg, proto_msg, distance);
+  return proto_msg;
+}
+GameEvent_DefenderInDefenseAreaPartially toProto(
+  const ssl_league_msgs::msg::DefenderInDefenseAreaPartially & ros_msg)
+{
+  GameEvent_DefenderInDefenseAreaPartially proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  CopyOptionalToProto(ros_msg, proto_msg, by_bot);
+  CopyOptionalStructToProto(ros_msg, proto_msg, location);
+  CopyOptionalToProto(ros_msg, proto_msg, distance);
+  CopyOptionalStructToProto(ros_msg, proto_msg, ball_location);
+  return proto_msg;
+}
+GameEvent_DefenderTooCloseToKickPoint toProto(
+  const ssl_league_msgs::msg::DefenderTooCloseToKickPoint & ros_msg)
+{
+  GameEvent_DefenderTooCloseToKickPoint proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  CopyOptionalToProto(ros_msg, proto_msg, by_bot);
+  CopyOptionalStructToProto(ros_msg, proto_msg, location);
+  CopyOptionalToProto(ros_msg, proto_msg, distance);
+  return proto_msg;
+}
+GameEvent_EmergencyStop toProto(const ssl_league_msgs::msg::EmergencyStop & ros_msg)
+{
+  GameEvent_EmergencyStop proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  return proto_msg;
+}
+GameEvent_Goal toProto(const ssl_league_msgs::msg::Goal & ros_msg)
+{
+  GameEvent_Goal proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  if (!ros_msg.kicking_team.empty()) {
+    proto_msg.set_kicking_team(toProto(ros_msg.kicking_team.front()));
+  }
+  CopyOptionalToProto(ros_msg, proto_msg, kicking_bot);
+  CopyOptionalStructToProto(ros_msg, proto_msg, location);
+  CopyOptionalStructToProto(ros_msg, proto_msg, kick_location);
+  CopyOptionalToProto(ros_msg, proto_msg, max_ball_height);
+  CopyOptionalToProto(ros_msg, proto_msg, num_robots_by_team);
+  CopyOptionalToProto(ros_msg, proto_msg, last_touch_by_team);
+  CopyOptionalToProto(ros_msg, proto_msg, message);
+  return proto_msg;
+}
+GameEvent_IndirectGoal toProto(const ssl_league_msgs::msg::IndirectGoal & ros_msg)
+{
+  GameEvent_IndirectGoal proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  CopyOptionalToProto(ros_msg, proto_msg, by_bot);
+  CopyOptionalStructToProto(ros_msg, proto_msg, location);
+  CopyOptionalStructToProto(ros_msg, proto_msg, kick_location);
+  return proto_msg;
+}
+GameEvent_KeeperHeldBall toProto(const ssl_league_msgs::msg::KeeperHeldBall & ros_msg)
+{
+  GameEvent_KeeperHeldBall proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  CopyOptionalStructToProto(ros_msg, proto_msg, location);
+  CopyOptionalToProto(ros_msg, proto_msg, duration);
+  return proto_msg;
+}
+GameEvent_KickTimeout toProto(const ssl_league_msgs::msg::KickTimeout & ros_msg)
+{
+  GameEvent_KickTimeout proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  CopyOptionalStructToProto(ros_msg, proto_msg, location);
+  CopyOptionalToProto(ros_msg, proto_msg, time);
+  return proto_msg;
+}
+GameEvent_MultipleCards toProto(const ssl_league_msgs::msg::MultipleCards & ros_msg)
+{
+  GameEvent_MultipleCards proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  return proto_msg;
+}
+GameEvent_MultipleFouls toProto(const ssl_league_msgs::msg::MultipleFouls & ros_msg)
+{
+  GameEvent_MultipleFouls proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  return proto_msg;
+}
+GameEvent_MultiplePlacementFailures toProto(
+  const ssl_league_msgs::msg::MultiplePlacementFailures & ros_msg)
+{
+  GameEvent_MultiplePlacementFailures proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  return proto_msg;
+}
+GameEvent_NoProgressInGame toProto(const ssl_league_msgs::msg::NoProgressInGame & ros_msg)
+{
+  GameEvent_NoProgressInGame proto_msg;
+  CopyOptionalStructToProto(ros_msg, proto_msg, location);
+  CopyOptionalToProto(ros_msg, proto_msg, time);
+  return proto_msg;
+}
+GameEvent_PenaltyKickFailed toProto(const ssl_league_msgs::msg::PenaltyKickFailed & ros_msg)
+{
+  GameEvent_PenaltyKickFailed proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  CopyOptionalStructToProto(ros_msg, proto_msg, location);
+  return proto_msg;
+}
+GameEvent_PlacementFailed toProto(const ssl_league_msgs::msg::PlacementFailed & ros_msg)
+{
+  GameEvent_PlacementFailed proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  CopyOptionalToProto(ros_msg, proto_msg, remaining_distance);
+  return proto_msg;
+}
+GameEvent_PlacementSucceeded toProto(const ssl_league_msgs::msg::PlacementSucceeded & ros_msg)
+{
+  GameEvent_PlacementSucceeded proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  CopyOptionalToProto(ros_msg, proto_msg, time_taken);
+  CopyOptionalToProto(ros_msg, proto_msg, precision);
+  CopyOptionalToProto(ros_msg, proto_msg, distance);
+  return proto_msg;
+}
+GameEvent_Prepared toProto(const ssl_league_msgs::msg::Prepared & ros_msg)
+{
+  GameEvent_Prepared proto_msg;
+  CopyOptionalToProto(ros_msg, proto_msg, time_taken);
+  return proto_msg;
+}
+GameEvent_TooManyRobots toProto(const ssl_league_msgs::msg::TooManyRobots & ros_msg)
+{
+  GameEvent_TooManyRobots proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  CopyOptionalToProto(ros_msg, proto_msg, num_robots_allowed);
+  CopyOptionalToProto(ros_msg, proto_msg, num_robots_on_field);
+  CopyOptionalStructToProto(ros_msg, proto_msg, ball_location);
+  return proto_msg;
+}
+GameEvent_UnsportingBehaviorMajor toProto(
+  const ssl_league_msgs::msg::UnsportingBehaviorMajor & ros_msg)
+{
+  GameEvent_UnsportingBehaviorMajor proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  proto_msg.set_reason(ros_msg.reason);
+  return proto_msg;
+}
+GameEvent_UnsportingBehaviorMinor toProto(
+  const ssl_league_msgs::msg::UnsportingBehaviorMinor & ros_msg)
+{
+  GameEvent_UnsportingBehaviorMinor proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  proto_msg.set_reason(ros_msg.reason);
+  return proto_msg;
+}
+GameEvent_BotDroppedParts toProto(const ssl_league_msgs::msg::BotDroppedParts & ros_msg)
+{
+  GameEvent_BotDroppedParts proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  CopyOptionalToProto(ros_msg, proto_msg, by_bot);
+  CopyOptionalStructToProto(ros_msg, proto_msg, location);
+  CopyOptionalStructToProto(ros_msg, proto_msg, ball_location);
+  return proto_msg;
+}
+GameEvent_ChallengeFlagHandled toProto(const ssl_league_msgs::msg::ChallengeFlagHandled & ros_msg)
+{
+  GameEvent_ChallengeFlagHandled proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  proto_msg.set_accepted(ros_msg.accepted);
+  return proto_msg;
+}
+GameEvent_ExcessiveBotSubstitution toProto(
+  const ssl_league_msgs::msg::ExcessiveBotSubstitution & ros_msg)
+{
+  GameEvent_ExcessiveBotSubstitution proto_msg;
+  proto_msg.set_by_team(toProto(ros_msg.by_team));
+  return proto_msg;
+}
+SSL_DetectionBall toProto(const ssl_league_msgs::msg::VisionDetectionBall & ros_msg)
+{
+  SSL_DetectionBall proto_msg;
+  proto_msg.set_confidence(ros_msg.confidence);
+  proto_msg.set_area(ros_msg.area);
+  proto_msg.set_x(ros_msg.pos.x * mToMm);
+  proto_msg.set_y(ros_msg.pos.y * mToMm);
+  proto_msg.set_z(ros_msg.pos.z * mToMm);
+  proto_msg.set_pixel_x(ros_msg.pixel.x);
+  proto_msg.set_pixel_y(ros_msg.pixel.y);
+
+  return proto_msg;
+}
+SSL_DetectionRobot toProto(const ssl_league_msgs::msg::VisionDetectionRobot & ros_msg)
+{
+  SSL_DetectionRobot proto_msg;
+  proto_msg.set_confidence(ros_msg.confidence);
+  proto_msg.set_robot_id(ros_msg.robot_id);
+  proto_msg.set_x(ros_msg.pose.position.x * mToMm);
+  proto_msg.set_y(ros_msg.pose.position.y * mToMm);
+  proto_msg.set_orientation(tf2::getYaw(ros_msg.pose.orientation));
+  proto_msg.set_pixel_x(ros_msg.pixel.x);
+  proto_msg.set_pixel_y(ros_msg.pixel.y);
+  proto_msg.set_height(ros_msg.height);
+
+  return proto_msg;
+}
+SSL_DetectionFrame toProto(const ssl_league_msgs::msg::VisionDetectionFrame & ros_msg)
+{
+  SSL_DetectionFrame proto_msg;
+  proto_msg.set_frame_number(ros_msg.frame_number);
+  proto_msg.set_t_capture(rclcpp::Time(ros_msg.t_capture).seconds());
+  proto_msg.set_t_sent(rclcpp::Time(ros_msg.t_sent).seconds());
+  // fromProto maps a missing camera capture time to zero
+  const rclcpp::Time t_capture_camera(ros_msg.t_capture_camera);
+  if (t_capture_camera.nanoseconds() != 0) {
+    proto_msg.set_t_capture_camera(t_capture_camera.seconds());
+  }
+  proto_msg.set_camera_id(ros_msg.camera_id);
+  for (const auto & ball : ros_msg.balls) {
+    *proto_msg.add_balls() = toProto(ball);
+  }
+  for (const auto & robot : ros_msg.robots_yellow) {
+    *proto_msg.add_robots_yellow() = toProto(robot);
+  }
+  for (const auto & robot : ros_msg.robots_blue) {
+    *proto_msg.add_robots_blue() = toProto(robot);
+  }
+
+  return proto_msg;
+}
+
+SSL_FieldLineSegment toProto(const ssl_league_msgs::msg::VisionFieldLineSegment & ros_msg)
+{
+  SSL_FieldLineSegment proto_msg;
+  proto_msg.set_name(ros_msg.name);
+  proto_msg.mutable_p1()->set_x(ros_msg.p1.x * mToMm);
+  proto_msg.mutable_p1()->set_y(ros_msg.p1.y * mToMm);
+  proto_msg.mutable_p2()->set_x(ros_msg.p2.x * mToMm);
+  proto_msg.mutable_p2()->set_y(ros_msg.p2.y * mToMm);
+  proto_msg.set_thickness(ros_msg.thickness * mToMm);
+
+  return proto_msg;
+}
+SSL_FieldCircularArc toProto(const ssl_league_msgs::msg::VisionFieldCircularArc & ros_msg)
+{
+  SSL_FieldCircularArc proto_msg;
+  proto_msg.set_name(ros_msg.name);
+  proto_msg.mutable_center()->set_x(ros_msg.center.x * mToMm);
+  proto_msg.mutable_center()->set_y(ros_msg.center.y * mToMm);
+  proto_msg.set_radius(ros_msg.radius * mToMm);
+  proto_msg.set_a1(ros_msg.a1);
+  proto_msg.set_a2(ros_msg.a2);
+  proto_msg.set_thickness(ros_msg.thickness * mToMm);
+
+  return proto_msg;
+}
+SSL_GeometryFieldSize toProto(const ssl_league_msgs::msg::VisionGeometryFieldSize & ros_msg)
+{
+  SSL_GeometryFieldSize proto_msg;
+  proto_msg.set_field_length(std::lround(ros_msg.field_length * mToMm));
+  proto_msg.set_field_width(std::lround(ros_msg.field_width * mToMm));
+  proto_msg.set_goal_width(std::lround(ros_msg.goal_width * mToMm));
+  proto_msg.set_goal_depth(std::lround(ros_msg.goal_depth * mToMm));
+  proto_msg.set_boundary_width(std::lround(ros_msg.boundary_width * mToMm));
+  for (const auto & line : ros_msg.field_lines) {
+    *proto_msg.add_field_lines() = toProto(line);
+  }
+  for (const auto & arc : ros_msg.field_arcs) {
+    *proto_msg.add_field_arcs() = toProto(arc);
+  }
+
+  // fromProto maps missing optional sizes to zero
+  const auto set_if_present = [&proto_msg](auto setter, float value) {
+      if (value != 0.0f) {
+        (proto_msg.*setter)(std::lround(value * mToMm));
+      }
+    };
+  set_if_present(&SSL_GeometryFieldSize::set_penalty_area_depth, ros_msg.penalty_area_depth);
+  set_if_present(&SSL_GeometryFieldSize::set_penalty_area_width, ros_msg.penalty_area_width);
+  set_if_present(&SSL_GeometryFieldSize::set_center_circle_radius, ros_msg.center_circle_radius);
+  set_if_present(&SSL_GeometryFieldSize::set_line_thickness, ros_msg.line_thickness);
+  set_if_present(
+    &SSL_GeometryFieldSize::set_goal_center_to_penalty_mark,
+    ros_msg.goal_center_to_penalty_mark);
+  set_if_present(&SSL_GeometryFieldSize::set_goal_height, ros_msg.goal_height);
+  set_if_present(&SSL_GeometryFieldSize::set_ball_radius, ros_msg.ball_radius);
+  set_if_present(&SSL_GeometryFieldSize::set_max_robot_radius, ros_msg.max_robot_radius);
+
+  return proto_msg;
+}
+SSL_GeometryCameraCalibration toProto(
+  const ssl_league_msgs::msg::VisionGeometryCameraCalibration & ros_msg)
+{
+  SSL_GeometryCameraCalibration proto_msg;
+  proto_msg.set_camera_id(ros_msg.camera_id);
+  proto_msg.set_focal_length(ros_msg.focal_length);
+  proto_msg.set_principal_point_x(ros_msg.principal_point.x);
+  proto_msg.set_principal_point_y(ros_msg.principal_point.y);
+  proto_msg.set_distortion(ros_msg.distortion);
+  proto_msg.set_q0(ros_msg.pose.orientation.x);
+  proto_msg.set_q1(ros_msg.pose.orientation.y);
+  proto_msg.set_q2(ros_msg.pose.orientation.z);
+  proto_msg.set_q3(ros_msg.pose.orientation.w);
+  proto_msg.set_tx(ros_msg.pose.position.x * mToMm);
+  proto_msg.set_ty(ros_msg.pose.position.y * mToMm);
+  proto_msg.set_tz(ros_msg.pose.position.z * mToMm);
+  proto_msg.set_derived_camera_world_tx(ros_msg.derived_camera_world_t.x * mToMm);
+  proto_msg.set_derived_camera_world_ty(ros_msg.derived_camera_world_t.y * mToMm);
+  proto_msg.set_derived_camera_world_tz(ros_msg.derived_camera_world_t.z * mToMm);
+
+  return proto_msg;
+}
+SSL_GeometryData toProto(const ssl_league_msgs::msg::VisionGeometryData & ros_msg)
+{
+  SSL_GeometryData proto_msg;
+  *proto_msg.mutable_field() = toProto(ros_msg.field);
+  for (const auto & calibration : ros_msg.calibration) {
+    *proto_msg.add_calib() = toProto(calibration);
+  }
+
+  return proto_msg;
+}
+
+SSL_WrapperPacket toProto(const ssl_league_msgs::msg::VisionWrapper & ros_msg)
+{
+  SSL_WrapperPacket proto_msg;
+  if (!ros_msg.detection.empty()) {
+    *proto_msg.mutable_detection() = toProto(ros_msg.detection.front());
+  }
+  if (!ros_msg.geometry.empty()) {
+    *proto_msg.mutable_geometry() = toProto(ros_msg.geometry.front());
+  }
+
+  return proto_msg;
+}
+
+MoveWheelVelocity toProto(const ssl_league_msgs::msg::MoveWheelVelocity & ros_msg)
+{
+  MoveWheelVelocity proto_msg;
+  proto_msg.set_front_right(ros_msg.front_right);
+  proto_msg.set_back_right(ros_msg.back_right);
+  proto_msg.set_back_left(ros_msg.back_left);
+  proto_msg.set_front_left(ros_msg.front_left);
+
+  return proto_msg;
+}
+
+MoveLocalVelocity toProto(const ssl_league_msgs::msg::MoveLocalVelocity & ros_msg)
+{
+  MoveLocalVelocity proto_msg;
+  proto_msg.set_forward(ros_msg.forward);
+  proto_msg.set_left(ros_msg.left);
+  proto_msg.set_angular(ros_msg.angular);
+
+  return proto_msg;
+}
+
+MoveGlobalVelocity toProto(const ssl_league_msgs::msg::MoveGlobalVelocity & ros_msg)
+{
+  MoveGlobalVelocity proto_msg;
+  proto_msg.set_x(ros_msg.x);
+  proto_msg.set_y(ros_msg.y);
+  proto_msg.set_angular(ros_msg.angular);
+
+  return proto_msg;
+}
+
+RobotMoveCommand toProto(const ssl_league_msgs::msg::RobotMoveCommand & ros_msg)
+{
+  // The proto holds a oneof, so the last command set in the message wins
+  RobotMoveCommand proto_msg;
+  CopyOptionalStructToProto(ros_msg, proto_msg, wheel_velocity);
+  CopyOptionalStructToProto(ros_msg, proto_msg, local_velocity);
+  CopyOptionalStructToProto(ros_msg, proto_msg, global_velocity);
+
+  return proto_msg;
+}
+
+RobotCommand toProto(const ssl_league_msgs::msg::RobotCommand & ros_msg)
+{
+  RobotCommand proto_msg;
+  proto_msg.set_id(ros_msg.id);
+  CopyOptionalStructToProto(ros_msg, proto_msg, move_command);
+  CopyOptionalToProto(ros_msg, proto_msg, kick_speed);
+  CopyOptionalToProto(ros_msg, proto_msg, kick_angle);
+  CopyOptionalToProto(ros_msg, proto_msg, dribbler_speed);
+
+  return proto_msg;
+}
+
+RobotControl toProto(const ssl_league_msgs::msg::RobotControl & ros_msg)
+{
+  RobotControl proto_msg;
+  for (const auto & command : ros_msg.robot_commands) {
+    *proto_msg.add_robot_commands() = toProto(command);
+  }
+
+  return proto_msg;
+}
+
 }  // namespace ssl_ros_bridge::message_conversion
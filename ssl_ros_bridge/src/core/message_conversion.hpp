@@ -25,6 +25,9 @@
 #include <ssl_league_protobufs/ssl_gc_game_event.pb.h>
 #include <ssl_league_protobufs/ssl_gc_common.pb.h>
 #include <ssl_league_protobufs/ssl_gc_geometry.pb.h>
+#include <ssl_league_protobufs/ssl_simulation_error.pb.h>
+#include <ssl_league_protobufs/ssl_simulation_robot_control.pb.h>
+#include <ssl_league_protobufs/ssl_simulation_robot_feedback.pb.h>
 #include <ssl_league_protobufs/ssl_vision_detection.pb.h>
 #include <ssl_league_protobufs/ssl_vision_geometry.pb.h>
 #include <ssl_league_protobufs/ssl_vision_wrapper.pb.h>
@@ -34,6 +37,11 @@
 #include <ssl_league_msgs/msg/division.hpp>
 #include <ssl_league_msgs/msg/robot_id.hpp>
 #include <ssl_league_msgs/msg/team.hpp>
+#include <ssl_league_msgs/msg/robot_command.hpp>
+#include <ssl_league_msgs/msg/robot_control.hpp>
+#include <ssl_league_msgs/msg/robot_control_response.hpp>
+#include <ssl_league_msgs/msg/robot_feedback.hpp>
+#include <ssl_league_msgs/msg/simulator_error.hpp>
 #include <ssl_league_msgs/msg/vision_detection_ball.hpp>
 #include <ssl_league_msgs/msg/vision_detection_robot.hpp>
 #include <ssl_league_msgs/msg/vision_detection_frame.hpp>
@@ -132,6 +140,97 @@ ssl_league_msgs::msg::VisionGeometryData fromProto(const SSL_GeometryData & prot
 
 ssl_league_msgs::msg::VisionWrapper fromProto(const SSL_WrapperPacket & proto_msg);
 
+ssl_league_msgs::msg::SimulatorError fromProto(const SimulatorError & proto_msg);
+ssl_league_msgs::msg::RobotFeedback fromProto(const RobotFeedback & proto_msg);
+ssl_league_msgs::msg::RobotControlResponse fromProto(const RobotControlResponse & proto_msg);
+
+Vector2 toProto(const geometry_msgs::msg::Point32 & ros_msg);
+
+Referee toProto(const ssl_league_msgs::msg::Referee & ros_msg);
+Referee::TeamInfo toProto(const ssl_league_msgs::msg::TeamInfo & ros_msg);
+GameEvent toProto(const ssl_league_msgs::msg::GameEvent & ros_msg);
+GameEventProposalGroup toProto(const ssl_league_msgs::msg::GameEventProposalGroup & ros_msg);
+
+Division toProto(const ssl_league_msgs::msg::Division & ros_msg);
+RobotId toProto(const ssl_league_msgs::msg::RobotId & ros_msg);
+Team toProto(const ssl_league_msgs::msg::Team & ros_msg);
+
+GameEvent_AimlessKick toProto(const ssl_league_msgs::msg::AimlessKick & ros_msg);
+GameEvent_AttackerDoubleTouchedBall toProto(
+  const ssl_league_msgs::msg::AttackerDoubleTouchedBall & ros_msg);
+GameEvent_AttackerTooCloseToDefenseArea toProto(
+  const ssl_league_msgs::msg::AttackerTooCloseToDefenseArea & ros_msg);
+GameEvent_AttackerTouchedBallInDefenseArea toProto(
+  const ssl_league_msgs::msg::AttackerTouchedBallInDefenseArea & ros_msg);
+GameEvent_AttackerTouchedOpponentInDefenseArea toProto(
+  const ssl_league_msgs::msg::AttackerTouchedOpponentInDefenseArea & ros_msg);
+GameEvent_BallLeftField toProto(const ssl_league_msgs::msg::BallLeftField & ros_msg);
+GameEvent_BotCrashDrawn toProto(const ssl_league_msgs::msg::BotCrashDrawn & ros_msg);
+GameEvent_BotCrashUnique toProto(const ssl_league_msgs::msg::BotCrashUnique & ros_msg);
+GameEvent_BotDribbledBallTooFar toProto(
+  const ssl_league_msgs::msg::BotDribbledBallTooFar & ros_msg);
+GameEvent_BotHeldBallDeliberately toProto(
+  const ssl_league_msgs::msg::BotHeldBallDeliberately & ros_msg);
+GameEvent_BotInterferedPlacement toProto(
+  const ssl_league_msgs::msg::BotInterferedPlacement & ros_msg);
+GameEvent_BotKickedBallTooFast toProto(const ssl_league_msgs::msg::BotKickedBallTooFast & ros_msg);
+GameEvent_BotPushedBot toProto(const ssl_league_msgs::msg::BotPushedBot & ros_msg);
+GameEvent_BotSubstitution toProto(const ssl_league_msgs::msg::BotSubstitution & ros_msg);
+GameEvent_BotTippedOver toProto(const ssl_league_msgs::msg::BotTippedOver & ros_msg);
+GameEvent_BotTooFastInStop toProto(const ssl_league_msgs::msg::BotTooFastInStop & ros_msg);
+GameEvent_BoundaryCrossing toProto(const ssl_league_msgs::msg::BoundaryCrossing & ros_msg);
+GameEvent_ChallengeFlag toProto(const ssl_league_msgs::msg::ChallengeFlag & ros_msg);
+GameEvent_ChippedGoal toProto(const ssl_league_msgs::msg::ChippedGoal & ros_msg);
+GameEvent_DefenderInDefenseArea toProto(
+  const ssl_league_msgs::msg::DefenderInDefenseArea & ros_msg);
+GameEvent_DefenderInDefenseAreaPartially toProto(
+  const ssl_league_msgs::msg::DefenderInDefenseAreaPartially & ros_msg);
+GameEvent_DefenderTooCloseToKickPoint toProto(
+  const ssl_league_msgs::msg::DefenderTooCloseToKickPoint & ros_msg);
+GameEvent_EmergencyStop toProto(const ssl_league_msgs::msg::EmergencyStop & ros_msg);
+GameEvent_Goal toProto(const ssl_league_msgs::msg::Goal & ros_msg);
+GameEvent_IndirectGoal toProto(const ssl_league_msgs::msg::IndirectGoal & ros_msg);
+GameEvent_KeeperHeldBall toProto(const ssl_league_msgs::msg::KeeperHeldBall & ros_msg);
+GameEvent_KickTimeout toProto(const ssl_league_msgs::msg::KickTimeout & ros_msg);
+GameEvent_MultipleCards toProto(const ssl_league_msgs::msg::MultipleCards & ros_msg);
+GameEvent_MultipleFouls toProto(const ssl_league_msgs::msg::MultipleFouls & ros_msg);
+GameEvent_MultiplePlacementFailures toProto(
+  const ssl_league_msgs::msg::MultiplePlacementFailures & ros_msg);
+GameEvent_NoProgressInGame toProto(const ssl_league_msgs::msg::NoProgressInGame & ros_msg);
+GameEvent_PenaltyKickFailed toProto(const ssl_league_msgs::msg::PenaltyKickFailed & ros_msg);
+GameEvent_PlacementFailed toProto(const ssl_league_msgs::msg::PlacementFailed & ros_msg);
+GameEvent_PlacementSucceeded toProto(const ssl_league_msgs::msg::PlacementSucceeded & ros_msg);
+GameEvent_Prepared toProto(const ssl_league_msgs::msg::Prepared & ros_msg);
+GameEvent_TooManyRobots toProto(const ssl_league_msgs::msg::TooManyRobots & ros_msg);
+GameEvent_UnsportingBehaviorMajor toProto(
+  const ssl_league_msgs::msg::UnsportingBehaviorMajor & ros_msg);
+GameEvent_UnsportingBehaviorMinor toProto(
+  const ssl_league_msgs::msg::UnsportingBehaviorMinor & ros_msg);
+GameEvent_BotDroppedParts toProto(const ssl_league_msgs::msg::BotDroppedParts & ros_msg);
+GameEvent_ChallengeFlagHandled toProto(const ssl_league_msgs::msg::ChallengeFlagHandled & ros_msg);
+GameEvent_ExcessiveBotSubstitution toProto(
+  const ssl_league_msgs::msg::ExcessiveBotSubstitution & ros_msg);
+
+SSL_DetectionBall toProto(const ssl_league_msgs::msg::VisionDetectionBall & ros_msg);
+SSL_DetectionRobot toProto(const ssl_league_msgs::msg::VisionDetectionRobot & ros_msg);
+SSL_DetectionFrame toProto(const ssl_league_msgs::msg::VisionDetectionFrame & ros_msg);
+
+SSL_FieldLineSegment toProto(const ssl_league_msgs::msg::VisionFieldLineSegment & ros_msg);
+SSL_FieldCircularArc toProto(const ssl_league_msgs::msg::VisionFieldCircularArc & ros_msg);
+SSL_GeometryFieldSize toProto(const ssl_league_msgs::msg::VisionGeometryFieldSize & ros_msg);
+SSL_GeometryCameraCalibration toProto(
+  const ssl_league_msgs::msg::VisionGeometryCameraCalibration & ros_msg);
+SSL_GeometryData toProto(const ssl_league_msgs::msg::VisionGeometryData & ros_msg);
+
+SSL_WrapperPacket toProto(const ssl_league_msgs::msg::VisionWrapper & ros_msg);
+
+MoveWheelVelocity toProto(const ssl_league_msgs::msg::MoveWheelVelocity & ros_msg);
+MoveLocalVelocity toProto(const ssl_league_msgs::msg::MoveLocalVelocity & ros_msg);
+MoveGlobalVelocity toProto(const ssl_league_msgs::msg::MoveGlobalVelocity & ros_msg);
+RobotMoveCommand toProto(const ssl_league_msgs::msg::RobotMoveCommand & ros_msg);
+RobotCommand toProto(const ssl_league_msgs::msg::RobotCommand & ros_msg);
+RobotControl toProto(const ssl_league_msgs::msg::RobotControl & ros_msg);
+
 }  // namespace ssl_ros_bridge::message_conversion
 
 #endif  // CORE__MESSAGE_CONVERSION_HPP_
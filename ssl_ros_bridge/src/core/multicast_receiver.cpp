@@ -24,6 +24,9 @@
 #include <ifaddrs.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
+#include <linux/sockios.h>
+#include <sys/ioctl.h>
+#include <time.h>
 
 #include <algorithm>
 #include <iostream>
@@ -57,7 +60,12 @@ MulticastReceiver::MulticastReceiver(
   multicast_socket_.open(multicast_endpoint.protocol());
   multicast_socket_.set_option(boost::asio::ip::udp::socket::reuse_address(true));
   multicast_socket_.bind(multicast_endpoint);
-  if (interface_address.empty()) {
+  // Timestamps taken by the kernel are not delayed by scheduling of the receive thread. The first
+  // SIOCGSTAMPNS request turns them on, and fails because nothing has been received yet.
+  GetKernelReceiveTime();
+  if (!multicast_address.is_multicast()) {
+    // Plain unicast socket, used to exchange datagrams with a single peer
+  } else if (interface_address.empty()) {
     // If no interface specified, join on all interfaces
     const auto available_interface_addresses = GetIpAdresses(false);
     for(const auto & address : available_interface_addresses) {
@@ -114,24 +122,19 @@ void MulticastReceiver::SendTo(
   const std::string & address, const uint16_t port,
   const char * const data, const size_t length)
 {
-  if (length >= send_buffer_.size()) {
-    warning_handler_("Cannot send data. UDP send data length is larger than buffer.");
+  // UDP sends only copy into the kernel's socket buffer, so sending synchronously does not block
+  // on the network. It also lets callers send back to back without sharing a send buffer with
+  // the previous, possibly still pending, datagram.
+  boost::system::error_code error;
+  boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::make_address(address, error), port);
+  if (error) {
+    warning_handler_(std::format("Cannot send UDP data to '{}': {}", address, error.message()));
     return;
   }
-
-  // Copy to buffer
-  // Better to send an invalid packet than to overrun the buffer
-  // With the if statement above, this should never happen
-  memcpy(send_buffer_.data(), data, std::min(send_buffer_.size(), length));
-
-  boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address::from_string(address), port);
-
-  multicast_socket_.async_send_to(
-    boost::asio::buffer(send_buffer_, length),
-    endpoint,
-    boost::bind(
-      &MulticastReceiver::HandleUDPSendTo, this,
-      boost::asio::placeholders::error, boost::asio::placeholders::bytes_transferred));
+  multicast_socket_.send_to(boost::asio::buffer(data, length), endpoint, 0, error);
+  if (error) {
+    warning_handler_(std::format("Failure while sending UDP data: {}", error.message()));
+  }
 }
 
 void MulticastReceiver::HandleMulticastReceiveFrom(
@@ -145,7 +148,7 @@ void MulticastReceiver::HandleMulticastReceiveFrom(
 
   receive_callback_(
     sender_endpoint_.address().to_string(), sender_endpoint_.port(),
-    buffer_.data(), bytes_received);
+    buffer_.data(), bytes_received, GetKernelReceiveTime());
 
   multicast_socket_.async_receive_from(
     boost::asio::buffer(buffer_), sender_endpoint_,
@@ -155,11 +158,15 @@ void MulticastReceiver::HandleMulticastReceiveFrom(
 }
 
 
-void MulticastReceiver::HandleUDPSendTo(const boost::system::error_code & error, size_t)
+std::chrono::system_clock::time_point MulticastReceiver::GetKernelReceiveTime()
 {
-  if (error) {
-    warning_handler_(std::format("Failure while sending UDP data: {}", error.message()));
+  timespec receive_time{};
+  if (ioctl(multicast_socket_.native_handle(), SIOCGSTAMPNS, &receive_time) != 0) {
+    return std::chrono::system_clock::now();
   }
+  return std::chrono::system_clock::time_point(
+    std::chrono::duration_cast<std::chrono::system_clock::duration>(
+      std::chrono::seconds(receive_time.tv_sec) + std::chrono::nanoseconds(receive_time.tv_nsec)));
 }
 
 void MulticastReceiver::LogToStdCerr(const std::string & message)
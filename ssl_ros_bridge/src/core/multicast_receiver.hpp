@@ -21,6 +21,7 @@
 #ifndef CORE__MULTICAST_RECEIVER_HPP_
 #define CORE__MULTICAST_RECEIVER_HPP_
 
+#include <chrono>
 #include <format>
 #include <functional>
 #include <string>
@@ -37,14 +38,21 @@ public:
    * @param sender_port Port number of sender
    * @param data Data received in latest packet
    * @param data_length Length of data received
+   * @param receive_time When the kernel received the packet, or when it was read if the kernel
+   *                     did not timestamp it
    */
   using ReceiveCallback =
     std::function<void (const std::string & sender_address, const uint16_t sender_port,
-      uint8_t * data, size_t data_length)>;
+      uint8_t * data, size_t data_length, std::chrono::system_clock::time_point receive_time)>;
 
   using LogHandler =
     std::function<void (const std::string & message)>;
 
+  /**
+   * @param multicast_ip_address Multicast group to join. A unicast address, like 0.0.0.0, binds a
+   *                             plain UDP socket that only receives datagrams sent to it.
+   * @param multicast_port Port to bind. Zero binds an ephemeral port.
+   */
   MulticastReceiver(
     std::string multicast_ip_address,
     uint16_t multicast_port,
@@ -64,17 +72,16 @@ private:
   boost::asio::io_service io_service_;
   boost::asio::ip::udp::socket multicast_socket_;
   boost::asio::ip::udp::endpoint sender_endpoint_;
-  std::array<uint8_t, 4096> send_buffer_;
   std::array<uint8_t, 4096> buffer_;
   std::thread io_service_thread_;
 
   void HandleMulticastReceiveFrom(const boost::system::error_code & error, size_t bytes_received);
 
-  void HandleUDPSendTo(const boost::system::error_code & error, size_t bytes_sent);
-
   void JoinMulticastGroupOnAllV4Interfaces(const boost::asio::ip::address & multicast_address);
 
   void LogToStdCerr(const std::string & message);
+
+  std::chrono::system_clock::time_point GetKernelReceiveTime();
 };
 
 }  // namespace ssl_ros_bridge::core
@@ -0,0 +1,119 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "pcap_log_source.hpp"
+#include <exception>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <utility>
+#include "log_format.hpp"
+
+namespace ssl_ros_bridge::core
+{
+
+namespace
+{
+
+constexpr uint32_t MakeIpv4Address(
+  const uint8_t a, const uint8_t b, const uint8_t c, const uint8_t d)
+{
+  return (uint32_t{a} << 24) | (uint32_t{b} << 16) | (uint32_t{c} << 8) | d;
+}
+
+std::vector<UdpEndpoint> GetEndpoints(const std::vector<CapturedStream> & streams)
+{
+  std::vector<UdpEndpoint> endpoints;
+  endpoints.reserve(streams.size());
+  for(const auto & stream : streams) {
+    endpoints.push_back(stream.endpoint);
+  }
+  return endpoints;
+}
+
+}  // namespace
+
+std::vector<CapturedStream> GetDefaultCapturedStreams()
+{
+  return {
+    {{MakeIpv4Address(224, 5, 23, 2), 10020}, EntryType::Vision2014},
+    {{MakeIpv4Address(224, 5, 23, 1), 10003}, EntryType::Refbox2013}
+  };
+}
+
+PcapLogSource::PcapLogSource(
+  std::span<const uint8_t> capture_data, std::vector<CapturedStream> streams)
+: reader_(capture_data),
+  streams_(std::move(streams)),
+  extractor_(GetEndpoints(streams_))
+{
+}
+
+ByteSource::Block PcapLogSource::ReadBlock()
+{
+  if(read_error_) {
+    finished_ = true;
+    std::rethrow_exception(std::exchange(read_error_, nullptr));
+  }
+  if(finished_) {
+    return nullptr;
+  }
+  auto block = std::make_shared<std::vector<uint8_t>>();
+  block->reserve(kBlockSize + std::numeric_limits<uint16_t>::max() + log_format::kEntryHeaderSize);
+  if(!header_written_) {
+    block->assign(log_format::kFileHeader.begin(), log_format::kFileHeader.end());
+    header_written_ = true;
+  }
+  while(block->size() < kBlockSize) {
+    std::optional<CapturedPacket> packet;
+    try {
+      packet = reader_.GetNextPacket();
+    } catch (const std::runtime_error &) {
+      // Hand out the entries before the corruption first
+      if(block->empty()) {
+        throw;
+      }
+      read_error_ = std::current_exception();
+      break;
+    }
+    if(!packet) {
+      finished_ = true;
+      break;
+    }
+    const auto datagram = extractor_.AddPacket(*packet);
+    if(!datagram) {
+      continue;
+    }
+    const auto header_offset = block->size();
+    block->resize(header_offset + log_format::kEntryHeaderSize);
+    const auto header = block->data() + header_offset;
+    log_format::WriteBigEndian<int64_t>(datagram->capture_time_ns, header);
+    log_format::WriteBigEndian<int32_t>(
+      static_cast<int32_t>(streams_[datagram->endpoint_index].entry_type), header + 8);
+    log_format::WriteBigEndian<int32_t>(datagram->payload.size(), header + 12);
+    block->insert(block->end(), datagram->payload.begin(), datagram->payload.end());
+  }
+  if(block->empty()) {
+    return nullptr;
+  }
+  return block;
+}
+
+}  // namespace ssl_ros_bridge::core
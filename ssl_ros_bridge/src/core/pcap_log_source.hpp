@@ -0,0 +1,97 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef CORE__PCAP_LOG_SOURCE_HPP_
+#define CORE__PCAP_LOG_SOURCE_HPP_
+
+#include <cstdint>
+#include <exception>
+#include <span>
+#include <vector>
+#include "byte_source.hpp"
+#include "log_reader.hpp"
+#include "pcap_reader.hpp"
+#include "udp_datagram_extractor.hpp"
+
+namespace ssl_ros_bridge::core
+{
+
+/**
+ * A UDP stream recorded in a capture, and the type of the log entries its datagrams become.
+ */
+struct CapturedStream
+{
+  UdpEndpoint endpoint;
+  EntryType entry_type;
+};
+
+/**
+ * The vision (224.5.23.2:10020) and referee (224.5.23.1:10003) multicast groups which the bridge
+ * nodes listen to by default.
+ */
+std::vector<CapturedStream> GetDefaultCapturedStreams();
+
+/**
+ * Presents the SSL datagrams of a pcap or pcapng capture as the bytes of an SSL log, so captures
+ * can be read with LogReader like any other log.
+ *
+ * Each datagram becomes one entry stamped with its capture time. Packets are read from the
+ * capture as blocks are requested, so memory use does not depend on the size of the capture.
+ */
+class PcapLogSource : public ByteSource {
+public:
+  /**
+   * @param capture_data Entire capture file, which must outlive this source
+   * @throws std::runtime_error if the data is not a supported capture format
+   */
+  explicit PcapLogSource(
+    std::span<const uint8_t> capture_data,
+    std::vector<CapturedStream> streams = GetDefaultCapturedStreams());
+
+  Block ReadBlock() override;
+
+  double GetProgress() const override
+  {
+    return reader_.GetProgress();
+  }
+
+  /**
+   * Number of fragmented datagrams which were never completed.
+   */
+  uint64_t GetIncompleteDatagramCount() const
+  {
+    return extractor_.GetIncompleteDatagramCount();
+  }
+
+private:
+  static constexpr std::size_t kBlockSize = 1 << 20;
+
+  PcapReader reader_;
+  std::vector<CapturedStream> streams_;
+  UdpDatagramExtractor extractor_;
+  bool header_written_{false};
+  bool finished_{false};
+  // Thrown by the next ReadBlock(), once the entries read before it have been returned
+  std::exception_ptr read_error_;
+};
+
+}  // namespace ssl_ros_bridge::core
+
+#endif  // CORE__PCAP_LOG_SOURCE_HPP_
@@ -0,0 +1,275 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "pcap_reader.hpp"
+#include <stdexcept>
+#include <string>
+
+namespace ssl_ros_bridge::core
+{
+
+namespace
+{
+
+constexpr uint32_t kPcapMicrosecondMagic = 0xA1B2C3D4;
+constexpr uint32_t kPcapNanosecondMagic = 0xA1B23C4D;
+constexpr std::size_t kPcapHeaderSize = 24;
+constexpr std::size_t kPcapRecordHeaderSize = 16;
+
+constexpr uint32_t kSectionHeaderBlock = 0x0A0D0D0A;
+constexpr uint32_t kInterfaceDescriptionBlock = 1;
+constexpr uint32_t kObsoletePacketBlock = 2;
+constexpr uint32_t kSimplePacketBlock = 3;
+constexpr uint32_t kEnhancedPacketBlock = 6;
+constexpr uint32_t kByteOrderMagic = 0x1A2B3C4D;
+// Block type and length before the body, and the repeated length after it
+constexpr std::size_t kBlockHeaderSize = 8;
+constexpr std::size_t kBlockTrailerSize = 4;
+
+constexpr uint16_t kEndOfOptions = 0;
+constexpr uint16_t kTimestampResolutionOption = 9;
+constexpr uint16_t kTimestampOffsetOption = 14;
+
+template<typename T>
+T ReadInteger(const uint8_t * data, const bool big_endian)
+{
+  std::make_unsigned_t<T> value = 0;
+  for(std::size_t i = 0; i < sizeof(T); ++i) {
+    const auto shift = big_endian ? 8 * (sizeof(T) - 1 - i) : 8 * i;
+    value |= static_cast<std::make_unsigned_t<T>>(data[i]) << shift;
+  }
+  return static_cast<T>(value);
+}
+
+std::size_t PadToFourBytes(const std::size_t size)
+{
+  return (size + 3) & ~std::size_t{3};
+}
+
+}  // namespace
+
+bool IsPacketCapture(std::span<const uint8_t> data)
+{
+  if(data.size() < sizeof(uint32_t)) {
+    return false;
+  }
+  const auto is_pcap_magic = [](const uint32_t magic) {
+      return magic == kPcapMicrosecondMagic || magic == kPcapNanosecondMagic;
+    };
+  // The section header block type reads the same in either byte order
+  return ReadInteger<uint32_t>(data.data(), false) == kSectionHeaderBlock ||
+         is_pcap_magic(ReadInteger<uint32_t>(data.data(), false)) ||
+         is_pcap_magic(ReadInteger<uint32_t>(data.data(), true));
+}
+
+PcapReader::PcapReader(std::span<const uint8_t> data)
+: data_(data)
+{
+  if(!IsPacketCapture(data_)) {
+    throw std::runtime_error("Not a pcap or pcapng file.");
+  }
+  if(ReadInteger<uint32_t>(0) == kSectionHeaderBlock) {
+    // The section header is read like any other block, since it may be repeated
+    is_pcapng_ = true;
+    return;
+  }
+  if(data_.size() < kPcapHeaderSize) {
+    throw std::runtime_error("Not enough bytes for a pcap header.");
+  }
+  const auto big_endian_magic = core::ReadInteger<uint32_t>(data_.data(), true);
+  big_endian_ = big_endian_magic == kPcapMicrosecondMagic ||
+    big_endian_magic == kPcapNanosecondMagic;
+  const auto magic = ReadInteger<uint32_t>(0);
+  // The upper bits of the link type hold FCS information, which is not needed
+  const auto link_type = static_cast<LinkType>(ReadInteger<uint32_t>(20) & 0xFFFF);
+  interfaces_.push_back(
+    {link_type, magic == kPcapNanosecondMagic ? 1'000'000'000u : 1'000'000u, 0});
+  read_offset_ = kPcapHeaderSize;
+}
+
+std::optional<CapturedPacket> PcapReader::GetNextPacket()
+{
+  return is_pcapng_ ? GetNextPcapngPacket() : GetNextPcapPacket();
+}
+
+template<typename T>
+T PcapReader::ReadInteger(const std::size_t offset) const
+{
+  return core::ReadInteger<T>(data_.data() + offset, big_endian_);
+}
+
+std::optional<CapturedPacket> PcapReader::GetNextPcapPacket()
+{
+  if(data_.size() - read_offset_ < kPcapRecordHeaderSize) {
+    read_offset_ = data_.size();
+    return std::nullopt;
+  }
+  const auto seconds = ReadInteger<uint32_t>(read_offset_);
+  const auto fraction = ReadInteger<uint32_t>(read_offset_ + 4);
+  const auto captured_length = ReadInteger<uint32_t>(read_offset_ + 8);
+  const auto data_offset = read_offset_ + kPcapRecordHeaderSize;
+  if(data_.size() - data_offset < captured_length) {
+    read_offset_ = data_.size();
+    return std::nullopt;
+  }
+  read_offset_ = data_offset + captured_length;
+  const auto & interface = interfaces_.front();
+  return CapturedPacket{
+    GetTimeNs(interface, static_cast<uint64_t>(seconds) * interface.ticks_per_second + fraction),
+    interface.link_type,
+    data_.subspan(data_offset, captured_length)
+  };
+}
+
+std::optional<CapturedPacket> PcapReader::GetNextPcapngPacket()
+{
+  while(data_.size() - read_offset_ >= kBlockHeaderSize + kBlockTrailerSize) {
+    const auto block_type = ReadInteger<uint32_t>(read_offset_);
+    if(block_type == kSectionHeaderBlock) {
+      // Each section may use a different byte order, given by the magic after the length
+      if(data_.size() - read_offset_ < kBlockHeaderSize + sizeof(uint32_t)) {
+        break;
+      }
+      const auto byte_order_magic = data_.data() + read_offset_ + kBlockHeaderSize;
+      big_endian_ = core::ReadInteger<uint32_t>(byte_order_magic, true) == kByteOrderMagic;
+    }
+    const auto block_length = ReadInteger<uint32_t>(read_offset_ + 4);
+    if(block_length < kBlockHeaderSize + kBlockTrailerSize || block_length % 4 != 0) {
+      throw std::runtime_error(
+              "Invalid pcapng block length " + std::to_string(block_length) + " at offset " +
+              std::to_string(read_offset_) + ".");
+    }
+    if(data_.size() - read_offset_ < block_length) {
+      break;
+    }
+    const auto block_offset = read_offset_;
+    const auto body = data_.subspan(
+      read_offset_ + kBlockHeaderSize, block_length - kBlockHeaderSize - kBlockTrailerSize);
+    read_offset_ += block_length;
+
+    const auto get_interface = [&](const uint32_t interface_id) -> const Interface & {
+        if(interface_id >= interfaces_.size()) {
+          throw std::runtime_error(
+                  "Packet at offset " + std::to_string(block_offset) +
+                  " refers to unknown interface " + std::to_string(interface_id) + ".");
+        }
+        return interfaces_[interface_id];
+      };
+    const auto get_packet_data = [&](const std::size_t data_offset, const uint32_t length) {
+        if(body.size() < data_offset || body.size() - data_offset < length) {
+          throw std::runtime_error(
+                  "Packet at offset " + std::to_string(block_offset) +
+                  " is longer than its block.");
+        }
+        return body.subspan(data_offset, length);
+      };
+    const auto body_offset = block_offset + kBlockHeaderSize;
+    switch(block_type) {
+      case kSectionHeaderBlock:
+        interfaces_.clear();
+        break;
+      case kInterfaceDescriptionBlock:
+        ReadInterfaceDescription(body);
+        break;
+      case kEnhancedPacketBlock:
+        {
+          if(body.size() < 20) {
+            break;
+          }
+          const auto & interface = get_interface(ReadInteger<uint32_t>(body_offset));
+          const auto timestamp =
+            (static_cast<uint64_t>(ReadInteger<uint32_t>(body_offset + 4)) << 32) |
+            ReadInteger<uint32_t>(body_offset + 8);
+          return CapturedPacket{
+            GetTimeNs(interface, timestamp),
+            interface.link_type,
+            get_packet_data(20, ReadInteger<uint32_t>(body_offset + 12))
+          };
+        }
+      case kObsoletePacketBlock:
+        {
+          if(body.size() < 20) {
+            break;
+          }
+          const auto & interface = get_interface(ReadInteger<uint16_t>(body_offset));
+          const auto timestamp =
+            (static_cast<uint64_t>(ReadInteger<uint32_t>(body_offset + 4)) << 32) |
+            ReadInteger<uint32_t>(body_offset + 8);
+          return CapturedPacket{
+            GetTimeNs(interface, timestamp),
+            interface.link_type,
+            get_packet_data(20, ReadInteger<uint32_t>(body_offset + 12))
+          };
+        }
+      case kSimplePacketBlock:
+        // Simple packets have no timestamp, so they cannot be placed in a log
+      default:
+        break;
+    }
+  }
+  read_offset_ = data_.size();
+  return std::nullopt;
+}
+
+void PcapReader::ReadInterfaceDescription(std::span<const uint8_t> block)
+{
+  if(block.size() < 8) {
+    throw std::runtime_error("Interface description block is too short.");
+  }
+  Interface interface{
+    static_cast<LinkType>(core::ReadInteger<uint16_t>(block.data(), big_endian_)),
+    1'000'000,
+    0
+  };
+  std::size_t option_offset = 8;
+  while(block.size() - option_offset >= 4) {
+    const auto code = core::ReadInteger<uint16_t>(block.data() + option_offset, big_endian_);
+    const auto length = core::ReadInteger<uint16_t>(block.data() + option_offset + 2, big_endian_);
+    const auto value_offset = option_offset + 4;
+    if(code == kEndOfOptions || block.size() - value_offset < length) {
+      break;
+    }
+    const auto value = block.data() + value_offset;
+    if(code == kTimestampResolutionOption && length >= 1) {
+      // The high bit selects a power of two instead of a power of ten
+      const auto exponent = value[0] & 0x7F;
+      const uint64_t base = (value[0] & 0x80) ? 2 : 10;
+      interface.ticks_per_second = 1;
+      for(int i = 0; i < exponent && interface.ticks_per_second < (uint64_t{1} << 60); ++i) {
+        interface.ticks_per_second *= base;
+      }
+    } else if(code == kTimestampOffsetOption && length >= 8) {
+      interface.offset_ns = core::ReadInteger<int64_t>(value, big_endian_) * 1'000'000'000;
+    }
+    option_offset = value_offset + PadToFourBytes(length);
+  }
+  interfaces_.push_back(interface);
+}
+
+int64_t PcapReader::GetTimeNs(const Interface & interface, const uint64_t timestamp)
+{
+  const auto seconds = timestamp / interface.ticks_per_second;
+  const auto ticks = timestamp % interface.ticks_per_second;
+  const auto fraction_ns = static_cast<int64_t>(
+    static_cast<long double>(ticks) * 1e9L / interface.ticks_per_second);
+  return static_cast<int64_t>(seconds) * 1'000'000'000 + fraction_ns + interface.offset_ns;
+}
+
+}  // namespace ssl_ros_bridge::core
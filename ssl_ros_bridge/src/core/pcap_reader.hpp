@@ -0,0 +1,111 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef CORE__PCAP_READER_HPP_
+#define CORE__PCAP_READER_HPP_
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace ssl_ros_bridge::core
+{
+
+/// Link-layer header types from https://www.tcpdump.org/linktypes.html
+enum class LinkType : uint32_t
+{
+  Null = 0,
+  Ethernet = 1,
+  Raw = 101,
+  LinuxSll = 113,
+  Ipv4 = 228,
+  LinuxSll2 = 276
+};
+
+struct CapturedPacket
+{
+  int64_t capture_time_ns;
+  LinkType link_type;
+  // Points into the capture file. May be shorter than the packet on the wire if the capture was
+  // taken with a small snapshot length.
+  std::span<const uint8_t> data;
+};
+
+/**
+ * True if the data starts with a pcap or pcapng header.
+ */
+bool IsPacketCapture(std::span<const uint8_t> data);
+
+/**
+ * Walks the packets of a pcap or pcapng capture without copying them.
+ *
+ * A packet cut off at the end of the file, as left by an interrupted tcpdump, ends the capture.
+ */
+class PcapReader {
+public:
+  /**
+   * @param data Entire capture file, such as a MappedFile
+   * @throws std::runtime_error if the file is not a supported capture format
+   */
+  explicit PcapReader(std::span<const uint8_t> data);
+
+  /**
+   * Returns the next packet, or nullopt at the end of the capture.
+   *
+   * @throws std::runtime_error if the capture is corrupt
+   */
+  std::optional<CapturedPacket> GetNextPacket();
+
+  double GetProgress() const
+  {
+    return data_.empty() ? 1.0 : static_cast<double>(read_offset_) / data_.size();
+  }
+
+private:
+  struct Interface
+  {
+    LinkType link_type;
+    uint64_t ticks_per_second;
+    int64_t offset_ns;
+  };
+
+  std::span<const uint8_t> data_;
+  std::size_t read_offset_{0};
+  bool is_pcapng_{false};
+  bool big_endian_{false};
+  // Classic pcap files have a single interface
+  std::vector<Interface> interfaces_;
+
+  template<typename T>
+  T ReadInteger(std::size_t offset) const;
+
+  std::optional<CapturedPacket> GetNextPcapPacket();
+
+  std::optional<CapturedPacket> GetNextPcapngPacket();
+
+  void ReadInterfaceDescription(std::span<const uint8_t> block);
+
+  static int64_t GetTimeNs(const Interface & interface, uint64_t timestamp);
+};
+
+}  // namespace ssl_ros_bridge::core
+
+#endif  // CORE__PCAP_READER_HPP_
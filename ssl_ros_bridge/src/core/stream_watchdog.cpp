@@ -0,0 +1,188 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "stream_watchdog.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace ssl_ros_bridge::core
+{
+
+namespace
+{
+// Weight of the newest sample in the learned period
+constexpr double kPeriodFilterGain = 0.1;
+// Checks per stale timeout, which bounds how late an outage is reported
+constexpr int kChecksPerTimeout = 4;
+}  // namespace
+
+StreamWatchdog::StreamWatchdog(
+  const double missed_periods,
+  const std::chrono::steady_clock::duration initial_period,
+  const std::chrono::steady_clock::duration min_period,
+  StateChangeCallback state_change_callback)
+: missed_periods_(missed_periods),
+  initial_period_(initial_period),
+  min_period_(min_period),
+  state_change_callback_(state_change_callback)
+{
+}
+
+void StreamWatchdog::NotifyReceived(
+  const std::string & name,
+  const std::chrono::steady_clock::time_point receive_time)
+{
+  bool changed = false;
+  {
+    std::lock_guard lock(mutex_);
+    changed = UpdateStream(name, receive_time);
+  }
+  if (changed) {
+    DeliverNotifications();
+  }
+}
+
+bool StreamWatchdog::UpdateStream(
+  const std::string & name,
+  const std::chrono::steady_clock::time_point receive_time)
+{
+  auto stream_iter = streams_.find(name);
+  if (stream_iter == streams_.end()) {
+    StreamRecord record;
+    record.state.name = name;
+    record.state.last_receive_time = receive_time;
+    record.state.expected_period = initial_period_;
+    streams_.emplace(name, record);
+    QueueNotification(record.state);
+    return true;
+  }
+
+  auto & record = stream_iter->second;
+  auto & state = record.state;
+  const auto interval = receive_time - state.last_receive_time;
+  state.last_receive_time = receive_time;
+  if (state.stale) {
+    // Don't learn from the outage itself
+    state.stale = false;
+    QueueNotification(state);
+    return true;
+  }
+  if (!record.period_measured) {
+    state.expected_period = interval;
+    record.period_measured = true;
+  } else {
+    state.expected_period += std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+      (interval - state.expected_period) * kPeriodFilterGain);
+  }
+  state.expected_period = std::max(state.expected_period, min_period_);
+  return false;
+}
+
+void StreamWatchdog::Check(const std::chrono::steady_clock::time_point now)
+{
+  bool changed = false;
+  {
+    std::lock_guard lock(mutex_);
+    for (auto & [name, record] : streams_) {
+      auto & state = record.state;
+      if (state.stale) {
+        continue;
+      }
+      const auto timeout = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        state.expected_period * missed_periods_);
+      if (now - state.last_receive_time > timeout) {
+        state.stale = true;
+        QueueNotification(state);
+        changed = true;
+      }
+    }
+  }
+  if (changed) {
+    DeliverNotifications();
+  }
+}
+
+std::vector<StreamWatchdog::StreamState> StreamWatchdog::GetStates() const
+{
+  std::lock_guard lock(mutex_);
+  return GetStatesLocked();
+}
+
+std::chrono::steady_clock::duration StreamWatchdog::GetCheckPeriod() const
+{
+  return std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+    initial_period_ * missed_periods_ / kChecksPerTimeout);
+}
+
+ssl_ros_bridge_msgs::msg::StreamWatchdogStatus StreamWatchdog::ToMsg(
+  const std::vector<StreamState> & states, const rclcpp::Time & ros_now)
+{
+  const auto steady_now = std::chrono::steady_clock::now();
+  ssl_ros_bridge_msgs::msg::StreamWatchdogStatus msg;
+  msg.stamp = ros_now;
+  for (const auto & state : states) {
+    auto & stream_msg = msg.streams.emplace_back();
+    stream_msg.name = state.name;
+    stream_msg.stale = state.stale;
+    stream_msg.last_receive_time = ros_now - rclcpp::Duration(steady_now - state.last_receive_time);
+    stream_msg.expected_period = rclcpp::Duration(state.expected_period);
+  }
+  return msg;
+}
+
+void StreamWatchdog::QueueNotification(const StreamState & changed_stream)
+{
+  if (state_change_callback_) {
+    pending_notifications_.push_back({changed_stream, GetStatesLocked()});
+  }
+}
+
+void StreamWatchdog::DeliverNotifications()
+{
+  // Whoever holds callback_mutex_ delivers every queued notification, including ones queued by
+  // other threads meanwhile
+  std::lock_guard callback_lock(callback_mutex_);
+  while (true) {
+    Notification notification;
+    {
+      std::lock_guard lock(mutex_);
+      if (pending_notifications_.empty()) {
+        return;
+      }
+      notification = std::move(pending_notifications_.front());
+      pending_notifications_.pop_front();
+    }
+    state_change_callback_(notification.changed_stream, notification.states);
+  }
+}
+
+std::vector<StreamWatchdog::StreamState> StreamWatchdog::GetStatesLocked() const
+{
+  std::vector<StreamState> states;
+  states.reserve(streams_.size());
+  std::ranges::transform(
+    streams_, std::back_inserter(states), [](const auto & entry) {
+      return entry.second.state;
+    });
+  return states;
+}
+
+}  // namespace ssl_ros_bridge::core
@@ -0,0 +1,139 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef CORE__STREAM_WATCHDOG_HPP_
+#define CORE__STREAM_WATCHDOG_HPP_
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <rclcpp/time.hpp>
+#include <ssl_ros_bridge_msgs/msg/stream_watchdog_status.hpp>
+
+namespace ssl_ros_bridge::core
+{
+
+/**
+ * Detects when periodic input streams stop arriving.
+ *
+ * The expected period of each stream is learned from its inter-arrival times. A stream is marked
+ * stale once it has been silent for a configurable number of expected periods, and recovers as
+ * soon as its next packet arrives. All methods are thread safe.
+ */
+class StreamWatchdog
+{
+public:
+  struct StreamState
+  {
+    std::string name;
+    bool stale{false};
+    std::chrono::steady_clock::time_point last_receive_time;
+    std::chrono::steady_clock::duration expected_period;
+  };
+
+  /**
+   * Called whenever a stream is first seen, becomes stale, or recovers.
+   *
+   * The callback runs after the watchdog's lock is released, on the thread which caused the
+   * change. Calls are never concurrent and are delivered in the order the changes happened.
+   *
+   * @param changed_stream State of the stream which changed
+   * @param states State of all streams, including the changed stream
+   */
+  using StateChangeCallback =
+    std::function<void (const StreamState & changed_stream,
+      const std::vector<StreamState> & states)>;
+
+  /**
+   * @param missed_periods Number of expected periods a stream may be silent before it is stale
+   * @param initial_period Expected period used until a stream's period has been measured
+   * @param min_period Lower bound on the learned period, which guards against bursts
+   * @param state_change_callback Called whenever a stream's stale state changes
+   */
+  StreamWatchdog(
+    const double missed_periods,
+    const std::chrono::steady_clock::duration initial_period,
+    const std::chrono::steady_clock::duration min_period,
+    StateChangeCallback state_change_callback);
+
+  void NotifyReceived(
+    const std::string & name,
+    const std::chrono::steady_clock::time_point receive_time = std::chrono::steady_clock::now());
+
+  /**
+   * Marks silent streams as stale. Call this more often than the shortest expected period.
+   */
+  void Check(const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+
+  std::vector<StreamState> GetStates() const;
+
+  /**
+   * Suggested time between calls to Check(), a fraction of the initial stale timeout.
+   */
+  std::chrono::steady_clock::duration GetCheckPeriod() const;
+
+  static ssl_ros_bridge_msgs::msg::StreamWatchdogStatus ToMsg(
+    const std::vector<StreamState> & states, const rclcpp::Time & ros_now);
+
+private:
+  const double missed_periods_;
+  const std::chrono::steady_clock::duration initial_period_;
+  const std::chrono::steady_clock::duration min_period_;
+  StateChangeCallback state_change_callback_;
+  struct StreamRecord
+  {
+    StreamState state;
+    bool period_measured{false};
+  };
+
+  struct Notification
+  {
+    StreamState changed_stream;
+    std::vector<StreamState> states;
+  };
+
+  mutable std::mutex mutex_;
+  std::map<std::string, StreamRecord> streams_;
+  std::deque<Notification> pending_notifications_;
+  // Held while delivering notifications, so they stay in order without holding mutex_
+  std::mutex callback_mutex_;
+
+  /**
+   * Updates a stream's state. Returns true if a notification was queued. Requires mutex_.
+   */
+  bool UpdateStream(
+    const std::string & name,
+    const std::chrono::steady_clock::time_point receive_time);
+
+  void QueueNotification(const StreamState & changed_stream);
+
+  void DeliverNotifications();
+
+  std::vector<StreamState> GetStatesLocked() const;
+};
+
+}  // namespace ssl_ros_bridge::core
+
+#endif  // CORE__STREAM_WATCHDOG_HPP_
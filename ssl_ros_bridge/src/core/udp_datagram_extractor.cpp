@@ -0,0 +1,241 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "udp_datagram_extractor.hpp"
+#include <algorithm>
+#include <utility>
+#include "log_format.hpp"
+
+namespace ssl_ros_bridge::core
+{
+
+namespace
+{
+
+constexpr uint16_t kEtherTypeIpv4 = 0x0800;
+constexpr uint16_t kEtherTypeVlan = 0x8100;
+constexpr uint16_t kEtherTypeQinQ = 0x88A8;
+constexpr std::size_t kEthernetHeaderSize = 14;
+constexpr std::size_t kVlanTagSize = 4;
+constexpr std::size_t kLinuxSllHeaderSize = 16;
+constexpr std::size_t kLinuxSll2HeaderSize = 20;
+constexpr std::size_t kNullHeaderSize = 4;
+constexpr uint32_t kNullFamilyIpv4 = 2;
+
+constexpr std::size_t kMinIpv4HeaderSize = 20;
+constexpr uint8_t kProtocolUdp = 17;
+constexpr uint16_t kMoreFragmentsFlag = 0x2000;
+constexpr uint16_t kFragmentOffsetMask = 0x1FFF;
+constexpr std::size_t kUdpHeaderSize = 8;
+
+using log_format::ReadBigEndian;
+
+}  // namespace
+
+UdpDatagramExtractor::UdpDatagramExtractor(std::vector<UdpEndpoint> endpoints)
+: endpoints_(std::move(endpoints))
+{
+}
+
+std::optional<UdpDatagram> UdpDatagramExtractor::AddPacket(const CapturedPacket & packet)
+{
+  auto ip_packet = GetIpv4Packet(packet);
+  if(ip_packet.size() < kMinIpv4HeaderSize || ip_packet[0] >> 4 != 4) {
+    return std::nullopt;
+  }
+  const std::size_t header_size = (ip_packet[0] & 0x0F) * 4;
+  const std::size_t total_size = ReadBigEndian<uint16_t>(ip_packet.data() + 2);
+  // Packets cut short by the snapshot length cannot be used
+  if(header_size < kMinIpv4HeaderSize || total_size < header_size ||
+    total_size > ip_packet.size() || ip_packet[9] != kProtocolUdp)
+  {
+    return std::nullopt;
+  }
+  // Ethernet pads short frames, so the IP length is used rather than the frame length
+  ip_packet = ip_packet.first(total_size);
+  const auto destination_address = ReadBigEndian<uint32_t>(ip_packet.data() + 16);
+  if(!IsEndpointAddress(destination_address)) {
+    return std::nullopt;
+  }
+  const auto payload = ip_packet.subspan(header_size);
+
+  const auto fragment_field = ReadBigEndian<uint16_t>(ip_packet.data() + 6);
+  const auto more_fragments = (fragment_field & kMoreFragmentsFlag) != 0;
+  const std::size_t fragment_offset = (fragment_field & kFragmentOffsetMask) * 8;
+  if(!more_fragments && fragment_offset == 0) {
+    return GetDatagram(packet.capture_time_ns, destination_address, payload);
+  }
+
+  const FragmentKey key{
+    ReadBigEndian<uint32_t>(ip_packet.data() + 12),
+    destination_address,
+    ReadBigEndian<uint16_t>(ip_packet.data() + 4)
+  };
+  const auto reassembled_payload = AddFragment(
+    key, packet.capture_time_ns, fragment_offset, more_fragments, payload);
+  if(!reassembled_payload) {
+    return std::nullopt;
+  }
+  return GetDatagram(packet.capture_time_ns, destination_address, *reassembled_payload);
+}
+
+std::span<const uint8_t> UdpDatagramExtractor::GetIpv4Packet(const CapturedPacket & packet)
+{
+  const auto & data = packet.data;
+  switch(packet.link_type) {
+    case LinkType::Ethernet:
+      {
+        std::size_t offset = kEthernetHeaderSize;
+        if(data.size() < offset) {
+          return {};
+        }
+        auto ether_type = ReadBigEndian<uint16_t>(data.data() + offset - 2);
+        while(ether_type == kEtherTypeVlan || ether_type == kEtherTypeQinQ) {
+          offset += kVlanTagSize;
+          if(data.size() < offset) {
+            return {};
+          }
+          ether_type = ReadBigEndian<uint16_t>(data.data() + offset - 2);
+        }
+        return ether_type == kEtherTypeIpv4 ? data.subspan(offset) : std::span<const uint8_t>();
+      }
+    case LinkType::LinuxSll:
+      if(data.size() < kLinuxSllHeaderSize ||
+        ReadBigEndian<uint16_t>(data.data() + 14) != kEtherTypeIpv4)
+      {
+        return {};
+      }
+      return data.subspan(kLinuxSllHeaderSize);
+    case LinkType::LinuxSll2:
+      if(data.size() < kLinuxSll2HeaderSize ||
+        ReadBigEndian<uint16_t>(data.data()) != kEtherTypeIpv4)
+      {
+        return {};
+      }
+      return data.subspan(kLinuxSll2HeaderSize);
+    case LinkType::Null:
+      {
+        // The family is in the byte order of the capturing machine
+        if(data.size() < kNullHeaderSize) {
+          return {};
+        }
+        const auto family = ReadBigEndian<uint32_t>(data.data());
+        if(family != kNullFamilyIpv4 && family != kNullFamilyIpv4 << 24) {
+          return {};
+        }
+        return data.subspan(kNullHeaderSize);
+      }
+    case LinkType::Raw:
+    case LinkType::Ipv4:
+      return data;
+    default:
+      return {};
+  }
+}
+
+bool UdpDatagramExtractor::IsEndpointAddress(const uint32_t address) const
+{
+  return std::ranges::any_of(
+    endpoints_, [address](const UdpEndpoint & endpoint) {
+      return endpoint.address == 0 || endpoint.address == address;
+    });
+}
+
+std::optional<std::span<const uint8_t>> UdpDatagramExtractor::AddFragment(
+  const FragmentKey & key, const int64_t capture_time_ns, const std::size_t offset,
+  const bool more_fragments, std::span<const uint8_t> fragment)
+{
+  DiscardExpiredDatagrams(capture_time_ns);
+  auto pending = pending_datagrams_.find(key);
+  if(pending == pending_datagrams_.end()) {
+    if(pending_datagrams_.size() >= kMaxPendingDatagrams) {
+      const auto oldest = std::ranges::min_element(
+        pending_datagrams_, {}, [](const auto & entry) {
+          return entry.second.first_capture_time_ns;
+        });
+      pending_datagrams_.erase(oldest);
+      incomplete_datagram_count_++;
+    }
+    pending = pending_datagrams_.emplace(key, PendingDatagram{capture_time_ns, {}, {}}).first;
+  }
+  auto & datagram = pending->second;
+  datagram.fragments.insert_or_assign(
+    offset, std::vector<uint8_t>(fragment.begin(), fragment.end()));
+  if(!more_fragments) {
+    datagram.total_size = offset + fragment.size();
+  }
+  if(!datagram.total_size) {
+    return std::nullopt;
+  }
+
+  // Fragments may overlap, so each one only has to start within the bytes covered so far
+  std::size_t covered_size = 0;
+  for(const auto & [fragment_offset, fragment_data] : datagram.fragments) {
+    if(fragment_offset > covered_size) {
+      return std::nullopt;
+    }
+    covered_size = std::max(covered_size, fragment_offset + fragment_data.size());
+  }
+  if(covered_size < *datagram.total_size) {
+    return std::nullopt;
+  }
+  reassembled_datagram_.assign(*datagram.total_size, 0);
+  for(const auto & [fragment_offset, fragment_data] : datagram.fragments) {
+    const auto size = std::min(fragment_data.size(), *datagram.total_size - fragment_offset);
+    std::copy_n(fragment_data.begin(), size, reassembled_datagram_.begin() + fragment_offset);
+  }
+  pending_datagrams_.erase(pending);
+  return std::span<const uint8_t>(reassembled_datagram_);
+}
+
+void UdpDatagramExtractor::DiscardExpiredDatagrams(const int64_t capture_time_ns)
+{
+  incomplete_datagram_count_ += std::erase_if(
+    pending_datagrams_, [capture_time_ns](const auto & entry) {
+      return capture_time_ns - entry.second.first_capture_time_ns > kReassemblyTimeoutNs;
+    });
+}
+
+std::optional<UdpDatagram> UdpDatagramExtractor::GetDatagram(
+  const int64_t capture_time_ns, const uint32_t destination_address,
+  std::span<const uint8_t> udp_packet) const
+{
+  if(udp_packet.size() < kUdpHeaderSize) {
+    return std::nullopt;
+  }
+  const auto destination_port = ReadBigEndian<uint16_t>(udp_packet.data() + 2);
+  const std::size_t udp_size = ReadBigEndian<uint16_t>(udp_packet.data() + 4);
+  if(udp_size < kUdpHeaderSize || udp_size > udp_packet.size()) {
+    return std::nullopt;
+  }
+  for(std::size_t i = 0; i < endpoints_.size(); ++i) {
+    const auto & endpoint = endpoints_[i];
+    if(endpoint.port == destination_port &&
+      (endpoint.address == 0 || endpoint.address == destination_address))
+    {
+      return UdpDatagram{
+        capture_time_ns, i, udp_packet.subspan(kUdpHeaderSize, udp_size - kUdpHeaderSize)
+      };
+    }
+  }
+  return std::nullopt;
+}
+
+}  // namespace ssl_ros_bridge::core
@@ -0,0 +1,125 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef CORE__UDP_DATAGRAM_EXTRACTOR_HPP_
+#define CORE__UDP_DATAGRAM_EXTRACTOR_HPP_
+
+#include <compare>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <span>
+#include <vector>
+#include "pcap_reader.hpp"
+
+namespace ssl_ros_bridge::core
+{
+
+struct UdpEndpoint
+{
+  // IPv4 address in host byte order, or 0 to match any address
+  uint32_t address;
+  uint16_t port;
+};
+
+struct UdpDatagram
+{
+  int64_t capture_time_ns;
+  // Index of the endpoint the datagram was sent to
+  std::size_t endpoint_index;
+  std::span<const uint8_t> payload;
+};
+
+/**
+ * Picks the UDP datagrams sent to a set of IPv4 endpoints out of captured packets, reassembling
+ * fragmented datagrams.
+ *
+ * Only fragments sent to one of the endpoint addresses are kept, and incomplete datagrams are
+ * discarded after a few seconds of capture time, so memory use stays bounded for any capture.
+ */
+class UdpDatagramExtractor
+{
+public:
+  explicit UdpDatagramExtractor(std::vector<UdpEndpoint> endpoints);
+
+  /**
+   * Returns the datagram carried or completed by the packet, if it was sent to one of the
+   * endpoints. The payload is valid until the next call or until the packet data is released.
+   */
+  std::optional<UdpDatagram> AddPacket(const CapturedPacket & packet);
+
+  /**
+   * Number of fragmented datagrams discarded because they were never completed.
+   */
+  uint64_t GetIncompleteDatagramCount() const
+  {
+    return incomplete_datagram_count_;
+  }
+
+private:
+  static constexpr int64_t kReassemblyTimeoutNs = 5'000'000'000;
+  static constexpr std::size_t kMaxPendingDatagrams = 256;
+
+  struct FragmentKey
+  {
+    uint32_t source_address;
+    uint32_t destination_address;
+    uint16_t identification;
+
+    auto operator<=>(const FragmentKey &) const = default;
+  };
+
+  struct PendingDatagram
+  {
+    int64_t first_capture_time_ns;
+    // IP payload of each fragment by its byte offset
+    std::map<std::size_t, std::vector<uint8_t>> fragments;
+    std::optional<std::size_t> total_size;
+  };
+
+  std::vector<UdpEndpoint> endpoints_;
+  std::map<FragmentKey, PendingDatagram> pending_datagrams_;
+  std::vector<uint8_t> reassembled_datagram_;
+  uint64_t incomplete_datagram_count_{0};
+
+  /**
+   * Returns the IPv4 packet inside a link-layer frame, or an empty span for other protocols.
+   */
+  static std::span<const uint8_t> GetIpv4Packet(const CapturedPacket & packet);
+
+  bool IsEndpointAddress(uint32_t address) const;
+
+  /**
+   * Stores a fragment and returns the whole IP payload once every fragment has arrived.
+   */
+  std::optional<std::span<const uint8_t>> AddFragment(
+    const FragmentKey & key, int64_t capture_time_ns, std::size_t offset, bool more_fragments,
+    std::span<const uint8_t> fragment);
+
+  void DiscardExpiredDatagrams(int64_t capture_time_ns);
+
+  std::optional<UdpDatagram> GetDatagram(
+    int64_t capture_time_ns, uint32_t destination_address, std::span<const uint8_t> udp_packet)
+  const;
+};
+
+}  // namespace ssl_ros_bridge::core
+
+#endif  // CORE__UDP_DATAGRAM_EXTRACTOR_HPP_
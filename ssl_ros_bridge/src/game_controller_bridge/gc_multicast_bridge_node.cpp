@@ -18,16 +18,23 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 #include <rclcpp/rclcpp.hpp>
 #include <rclcpp_components/register_node_macro.hpp>
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
 #include "core/message_conversion.hpp"
 #include "core/multicast_receiver.hpp"
 #include "core/protobuf_logging.hpp"
+#include "core/stream_watchdog.hpp"
+#include <ssl_ros_bridge_msgs/msg/stream_watchdog_status.hpp>
 #include <ssl_ros_bridge_msgs/msg/team_client_connection_status.hpp>
 #include <ssl_ros_bridge_msgs/srv/reconnect_team_client.hpp>
 #include <ssl_league_msgs/msg/referee.hpp>
+#include "referee_source_selector.hpp"
 
 namespace ssl_ros_bridge::game_controller_bridge
 {
@@ -52,6 +59,53 @@ public:
         std::bind(&GCMulticastBridgeNode::TeamClientConnectionStatusCallback, this,
         std::placeholders::_1));
 
+    reconnect_timer_ = create_wall_timer(
+      kReconnectTickPeriod,
+      std::bind(&GCMulticastBridgeNode::ReconnectTimerCallback, this));
+
+    stream_status_publisher_ = create_publisher<ssl_ros_bridge_msgs::msg::StreamWatchdogStatus>(
+      "~/stream_status", rclcpp::QoS(1).transient_local());
+    watchdog_ = std::make_unique<core::StreamWatchdog>(
+      declare_parameter<double>("watchdog.missed_periods", 2.0),
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(declare_parameter<double>("watchdog.initial_period", 0.1))),
+      std::chrono::milliseconds(1),
+      std::bind(&GCMulticastBridgeNode::PublishStreamStatus, this, std::placeholders::_1,
+      std::placeholders::_2));
+    // Zero derives the check period from the stale timeout
+    const auto watchdog_check_period = declare_parameter<double>("watchdog.check_period", 0.0);
+    watchdog_timer_ = create_wall_timer(
+      watchdog_check_period > 0.0 ?
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(watchdog_check_period)) :
+      watchdog_->GetCheckPeriod(),
+      [this]() {
+        watchdog_->Check();
+      });
+
+    const auto failover_periods =
+      declare_parameter<double>("source_selection.failover_periods", 1.0);
+    const auto initial_period = declare_parameter<double>("source_selection.initial_period", 0.1);
+    const auto failover_margin =
+      declare_parameter<double>("source_selection.failover_margin", 0.03);
+    const auto min_dwell_time = declare_parameter<double>("source_selection.min_dwell_time", 1.0);
+    source_selector_ = std::make_unique<RefereeSourceSelector>(
+      failover_periods,
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(initial_period)),
+      declare_parameter<std::string>("source_selection.preferred_source", ""),
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(failover_margin)),
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(min_dwell_time)));
+
+    diagnostics_publisher_ = create_publisher<diagnostic_msgs::msg::DiagnosticArray>(
+      "/diagnostics", rclcpp::SystemDefaultsQoS());
+    const auto diagnostics_period = declare_parameter<double>("diagnostics.period", 1.0);
+    diagnostics_timer_ = create_wall_timer(
+      std::chrono::duration<double>(diagnostics_period),
+      std::bind(&GCMulticastBridgeNode::PublishDiagnostics, this));
+
     const auto multicast_address =
       declare_parameter<std::string>("multicast.address", "224.5.23.1");
     const auto multicast_port = declare_parameter<int>("multicast.port", 10003);
@@ -70,49 +124,174 @@ public:
   }
 
 private:
+  enum class ReconnectState
+  {
+    Idle,
+    WaitingForResponse
+  };
+
   const std::chrono::seconds kReconnectTimeout{2};
   const std::chrono::seconds kReconnectRetryTime{1};
-  bool team_client_connected_ = false;
+  const std::chrono::milliseconds kReconnectTickPeriod{100};
+  std::atomic_bool team_client_connected_{false};
+  // Written by the multicast receive thread, read by the reconnect timer
+  std::mutex gc_address_mutex_;
+  std::string gc_address_;
+  // Only accessed from executor callbacks
+  ReconnectState reconnect_state_{ReconnectState::Idle};
+  int64_t reconnect_request_id_{0};
   std::chrono::steady_clock::time_point last_reconnect_attempt_time_;
   rclcpp::Publisher<ssl_league_msgs::msg::Referee>::SharedPtr referee_publisher_;
   rclcpp::Client<ssl_ros_bridge_msgs::srv::ReconnectTeamClient>::SharedPtr reconnect_client_;
+  rclcpp::TimerBase::SharedPtr reconnect_timer_;
   rclcpp::Subscription<ssl_ros_bridge_msgs::msg::TeamClientConnectionStatus>::SharedPtr
     team_client_connection_subscription_;
+  rclcpp::Publisher<ssl_ros_bridge_msgs::msg::StreamWatchdogStatus>::SharedPtr
+    stream_status_publisher_;
+  std::unique_ptr<core::StreamWatchdog> watchdog_;
+  rclcpp::TimerBase::SharedPtr watchdog_timer_;
+  std::unique_ptr<RefereeSourceSelector> source_selector_;
+  rclcpp::Publisher<diagnostic_msgs::msg::DiagnosticArray>::SharedPtr diagnostics_publisher_;
+  rclcpp::TimerBase::SharedPtr diagnostics_timer_;
   std::unique_ptr<core::MulticastReceiver> multicast_receiver_;
 
   void PublishMulticastMessage(
     const std::string & sender_address, const uint8_t * buffer,
     const size_t bytes_received)
   {
+    const auto receive_time = std::chrono::steady_clock::now();
     Referee referee_proto;
     if(!referee_proto.ParseFromArray(buffer, bytes_received)) {
       RCLCPP_WARN(get_logger(), "Failed to parse referee protobuf packet");
       return;
     }
+    const auto decision = source_selector_->Process(referee_proto, sender_address, receive_time);
+    switch(decision) {
+      case RefereeSourceSelector::Decision::AcceptAfterSwitch:
+        RCLCPP_WARN(
+          get_logger(), "Switched to referee source %s (%s).",
+          RefereeSourceSelector::GetSourceName(referee_proto, sender_address).c_str(),
+          sender_address.c_str());
+        break;
+      case RefereeSourceSelector::Decision::AcceptAfterReset:
+        RCLCPP_WARN(
+          get_logger(), "Referee source %s went back in time. Following its new sequence.",
+          RefereeSourceSelector::GetSourceName(referee_proto, sender_address).c_str());
+        break;
+      case RefereeSourceSelector::Decision::Accept:
+        break;
+      default:
+        return;
+    }
+    watchdog_->NotifyReceived("referee", receive_time);
     referee_publisher_->publish(message_conversion::fromProto(referee_proto));
+    if(!team_client_connected_) {
+      // Reconnecting is left to the executor so this thread never waits on the team client
+      std::lock_guard lock(gc_address_mutex_);
+      gc_address_ = sender_address;
+    }
+  }
+
+  void ReconnectTimerCallback()
+  {
+    const auto now = std::chrono::steady_clock::now();
+    if(reconnect_state_ == ReconnectState::WaitingForResponse) {
+      if(now - last_reconnect_attempt_time_ < kReconnectTimeout) {
+        return;
+      }
+      reconnect_client_->remove_pending_request(reconnect_request_id_);
+      reconnect_state_ = ReconnectState::Idle;
+      RCLCPP_WARN(get_logger(), "Timed out trying to reconnect team client.");
+    }
     if(team_client_connected_ || !reconnect_client_->service_is_ready()) {
       return;
     }
-    const auto now = std::chrono::steady_clock::now();
-    const auto time_since_last_attempt = now - last_reconnect_attempt_time_;
-    if(time_since_last_attempt < kReconnectRetryTime) {
+    if(now - last_reconnect_attempt_time_ < kReconnectRetryTime) {
       return;
     }
-    last_reconnect_attempt_time_ = now;
     auto request = std::make_shared<ssl_ros_bridge_msgs::srv::ReconnectTeamClient::Request>();
-    request->server_address = sender_address;
-    auto service_future = reconnect_client_->async_send_request(request);
-    if(service_future.wait_for(kReconnectTimeout) == std::future_status::timeout) {
-      RCLCPP_WARN(get_logger(), "Timed out trying to reconnect team client.");
-      return;
+    {
+      std::lock_guard lock(gc_address_mutex_);
+      if(gc_address_.empty()) {
+        return;
+      }
+      request->server_address = gc_address_;
     }
-    if(!service_future.get()->success) {
+    last_reconnect_attempt_time_ = now;
+    reconnect_state_ = ReconnectState::WaitingForResponse;
+    reconnect_request_id_ = reconnect_client_->async_send_request(
+      request,
+      std::bind(&GCMulticastBridgeNode::ReconnectResponseCallback, this,
+      std::placeholders::_1)).request_id;
+  }
+
+  void ReconnectResponseCallback(
+    rclcpp::Client<ssl_ros_bridge_msgs::srv::ReconnectTeamClient>::SharedFuture future)
+  {
+    reconnect_state_ = ReconnectState::Idle;
+    if(!future.get()->success) {
       RCLCPP_WARN(get_logger(), "Connecting team client to deduced GC server failed.");
       return;
     }
     team_client_connected_ = true;
   }
 
+  void PublishStreamStatus(
+    const core::StreamWatchdog::StreamState & changed_stream,
+    const std::vector<core::StreamWatchdog::StreamState> & states)
+  {
+    if (changed_stream.stale) {
+      RCLCPP_WARN(get_logger(), "Referee stream is stale.");
+    } else {
+      RCLCPP_INFO(get_logger(), "Referee stream is active.");
+    }
+    stream_status_publisher_->publish(core::StreamWatchdog::ToMsg(states, now()));
+  }
+
+  void PublishDiagnostics()
+  {
+    using diagnostic_msgs::msg::DiagnosticStatus;
+    const auto metrics = source_selector_->GetMetrics();
+    DiagnosticStatus status;
+    status.name = std::string(get_name()) + ": referee sources";
+    status.hardware_id = "game_controller";
+    if (metrics.source_count > 1) {
+      status.level = DiagnosticStatus::WARN;
+      status.message = "Multiple game controllers are sending. Using " + metrics.primary_source;
+    } else {
+      status.level = DiagnosticStatus::OK;
+      status.message = metrics.primary_source.empty() ? "No game controller seen" : "OK";
+    }
+    auto add_value = [&status](const std::string & key, const std::string & value) {
+        diagnostic_msgs::msg::KeyValue key_value;
+        key_value.key = key;
+        key_value.value = value;
+        status.values.push_back(key_value);
+      };
+    add_value("primary_source", metrics.primary_source);
+    add_value("source_count", std::to_string(metrics.source_count));
+    add_value("accepted_packets", std::to_string(metrics.accepted_packets));
+    add_value("rejected_duplicate_packets", std::to_string(metrics.rejected_duplicate_packets));
+    add_value("rejected_outdated_packets", std::to_string(metrics.rejected_outdated_packets));
+    add_value("rejected_backup_packets", std::to_string(metrics.rejected_backup_packets));
+    add_value("switch_count", std::to_string(metrics.switch_count));
+    add_value("reset_count", std::to_string(metrics.reset_count));
+    if (metrics.last_switch_time) {
+      const auto time_since_switch = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - *metrics.last_switch_time);
+      add_value("seconds_since_last_switch", std::to_string(time_since_switch.count()));
+      add_value(
+        "last_switch_gap_ms",
+        std::to_string(
+          std::chrono::duration<double, std::milli>(metrics.last_switch_gap).count()));
+    }
+
+    diagnostic_msgs::msg::DiagnosticArray diagnostics_msg;
+    diagnostics_msg.header.stamp = now();
+    diagnostics_msg.status.push_back(status);
+    diagnostics_publisher_->publish(diagnostics_msg);
+  }
+
   void TeamClientConnectionStatusCallback(
     const ssl_ros_bridge_msgs::msg::TeamClientConnectionStatus::ConstSharedPtr msg)
   {
@@ -0,0 +1,182 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "referee_source_selector.hpp"
+
+#include <algorithm>
+
+namespace ssl_ros_bridge::game_controller_bridge
+{
+
+namespace
+{
+// Weight of the newest sample in the learned packet period
+constexpr double kPeriodFilterGain = 0.1;
+// Reordered packets are only a few periods old. A bigger step back means the primary's clock or
+// state was reset. In microseconds, like packet_timestamp.
+constexpr uint64_t kMaxReorderAge = 1'000'000;
+// Consecutive outdated packets from the primary after which its new sequence is trusted
+constexpr int kOutdatedPacketsBeforeReset = 3;
+}  // namespace
+
+RefereeSourceSelector::RefereeSourceSelector(
+  const double failover_periods,
+  const std::chrono::steady_clock::duration initial_period,
+  const std::string & preferred_source,
+  const std::chrono::steady_clock::duration failover_margin,
+  const std::chrono::steady_clock::duration min_dwell_time)
+: failover_periods_(failover_periods),
+  initial_period_(initial_period),
+  preferred_source_(preferred_source),
+  failover_margin_(failover_margin),
+  min_dwell_time_(min_dwell_time)
+{
+}
+
+RefereeSourceSelector::Decision RefereeSourceSelector::Process(
+  const Referee & referee, const std::string & sender_address,
+  const std::chrono::steady_clock::time_point receive_time)
+{
+  const auto & source_name = GetSourceName(referee, sender_address);
+
+  std::lock_guard lock(mutex_);
+
+  const auto should_switch = ShouldSwitchTo(source_name, receive_time);
+  if (should_switch) {
+    const auto primary_iter = sources_.find(metrics_.primary_source);
+    if (primary_iter != sources_.end()) {
+      metrics_.last_switch_gap = receive_time - primary_iter->second.last_receive_time;
+    }
+    metrics_.primary_source = source_name;
+    metrics_.switch_count++;
+    metrics_.last_switch_time = receive_time;
+    last_command_counter_.reset();
+    last_packet_timestamp_.reset();
+    consecutive_outdated_packets_ = 0;
+  }
+
+  UpdateSource(source_name, receive_time);
+
+  if (source_name != metrics_.primary_source) {
+    metrics_.rejected_backup_packets++;
+    return Decision::RejectBackup;
+  }
+
+  if (last_packet_timestamp_ && referee.packet_timestamp() == *last_packet_timestamp_ &&
+    referee.command_counter() == *last_command_counter_)
+  {
+    metrics_.rejected_duplicate_packets++;
+    return Decision::RejectDuplicate;
+  }
+
+  auto decision = should_switch ? Decision::AcceptAfterSwitch : Decision::Accept;
+  if (last_packet_timestamp_ && (referee.packet_timestamp() < *last_packet_timestamp_ ||
+    referee.command_counter() < *last_command_counter_))
+  {
+    consecutive_outdated_packets_++;
+    if (!IsReset(referee) && consecutive_outdated_packets_ < kOutdatedPacketsBeforeReset) {
+      metrics_.rejected_outdated_packets++;
+      return Decision::RejectOutdated;
+    }
+    // The primary went back in time, so its new sequence replaces the old one
+    metrics_.reset_count++;
+    decision = Decision::AcceptAfterReset;
+  }
+
+  consecutive_outdated_packets_ = 0;
+  last_command_counter_ = referee.command_counter();
+  last_packet_timestamp_ = referee.packet_timestamp();
+  metrics_.accepted_packets++;
+  return decision;
+}
+
+RefereeSourceSelector::Metrics RefereeSourceSelector::GetMetrics() const
+{
+  std::lock_guard lock(mutex_);
+  auto metrics = metrics_;
+  metrics.source_count = sources_.size();
+  return metrics;
+}
+
+const std::string & RefereeSourceSelector::GetSourceName(
+  const Referee & referee,
+  const std::string & sender_address)
+{
+  return referee.has_source_identifier() ? referee.source_identifier() : sender_address;
+}
+
+void RefereeSourceSelector::UpdateSource(
+  const std::string & source_name,
+  const std::chrono::steady_clock::time_point receive_time)
+{
+  auto [source_iter, inserted] = sources_.try_emplace(source_name);
+  auto & source = source_iter->second;
+  const auto interval = receive_time - source.last_receive_time;
+  source.last_receive_time = receive_time;
+  if (inserted) {
+    source.period = initial_period_;
+  } else if (!source.period_measured) {
+    source.period = interval;
+    source.period_measured = true;
+  } else if (interval >= source.period / 2) {
+    // Game controllers send extra packets right after command changes. Learning from those
+    // bursts would shrink the period and trigger failover on normal jitter.
+    source.period += std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+      (interval - source.period) * kPeriodFilterGain);
+  }
+}
+
+bool RefereeSourceSelector::IsReset(const Referee & referee) const
+{
+  // A restarted game controller counts commands from zero again while its clock keeps going
+  if (referee.command_counter() < *last_command_counter_ &&
+    referee.packet_timestamp() > *last_packet_timestamp_)
+  {
+    return true;
+  }
+  return referee.packet_timestamp() < *last_packet_timestamp_ &&
+         *last_packet_timestamp_ - referee.packet_timestamp() > kMaxReorderAge;
+}
+
+bool RefereeSourceSelector::ShouldSwitchTo(
+  const std::string & source_name,
+  const std::chrono::steady_clock::time_point receive_time) const
+{
+  if (source_name == metrics_.primary_source) {
+    return false;
+  }
+  const auto primary_iter = sources_.find(metrics_.primary_source);
+  if (primary_iter == sources_.end()) {
+    // No primary yet
+    return true;
+  }
+  if (metrics_.last_switch_time && receive_time - *metrics_.last_switch_time < min_dwell_time_) {
+    return false;
+  }
+  if (!preferred_source_.empty() && source_name == preferred_source_) {
+    return true;
+  }
+  const auto & primary = primary_iter->second;
+  const auto failover_timeout = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+    primary.period * failover_periods_) + failover_margin_;
+  return (receive_time - primary.last_receive_time) > failover_timeout;
+}
+
+}  // namespace ssl_ros_bridge::game_controller_bridge
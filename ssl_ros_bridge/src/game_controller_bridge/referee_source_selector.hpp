@@ -0,0 +1,146 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef GAME_CONTROLLER_BRIDGE__REFEREE_SOURCE_SELECTOR_HPP_
+#define GAME_CONTROLLER_BRIDGE__REFEREE_SOURCE_SELECTOR_HPP_
+
+#include <ssl_league_protobufs/ssl_gc_referee_message.pb.h>
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+
+namespace ssl_ros_bridge::game_controller_bridge
+{
+
+/**
+ * Chooses which game controller to listen to when several are multicasting referee messages.
+ *
+ * The selector locks onto one primary source and rejects packets from all other sources, as well
+ * as duplicate or outdated packets from the primary. If the primary jumps back by more than a
+ * reordered packet could, or keeps sending outdated packets, its new sequence is accepted. When the
+ * primary has been silent for longer than the allowed number of its packet periods plus a jitter
+ * margin, the next packet from another source makes that source the new primary. After a switch,
+ * the new primary is kept for a minimum dwell time so jittery sources do not flap. All methods are
+ * thread safe.
+ */
+class RefereeSourceSelector
+{
+public:
+  enum class Decision
+  {
+    Accept,
+    /// This packet's source just became the primary
+    AcceptAfterSwitch,
+    /// The primary's timestamp or command counter went back, e.g. after a restart, and this
+    /// packet starts its new sequence
+    AcceptAfterReset,
+    RejectDuplicate,
+    RejectOutdated,
+    RejectBackup
+  };
+
+  struct Metrics
+  {
+    std::string primary_source;
+    std::size_t source_count{0};
+    uint64_t accepted_packets{0};
+    uint64_t rejected_duplicate_packets{0};
+    uint64_t rejected_outdated_packets{0};
+    uint64_t rejected_backup_packets{0};
+    uint64_t switch_count{0};
+    uint64_t reset_count{0};
+    std::optional<std::chrono::steady_clock::time_point> last_switch_time;
+    /// How long the previous primary had been silent when the last switch happened
+    std::chrono::steady_clock::duration last_switch_gap{};
+  };
+
+  /**
+   * @param failover_periods Number of the primary's packet periods it may be silent before
+   * another source takes over
+   * @param initial_period Packet period assumed until a source's period has been measured
+   * @param preferred_source Source to switch back to whenever it is sending. Empty to disable.
+   * @param failover_margin Extra silence allowed on top of failover_periods for packet jitter
+   * @param min_dwell_time Time after a switch before another switch is allowed
+   */
+  RefereeSourceSelector(
+    const double failover_periods,
+    const std::chrono::steady_clock::duration initial_period,
+    const std::string & preferred_source,
+    const std::chrono::steady_clock::duration failover_margin,
+    const std::chrono::steady_clock::duration min_dwell_time);
+
+  /**
+   * @param sender_address Used to identify sources which do not set source_identifier
+   * @return Whether the packet should be published, and why not if it shouldn't
+   */
+  Decision Process(
+    const Referee & referee, const std::string & sender_address,
+    const std::chrono::steady_clock::time_point receive_time);
+
+  Metrics GetMetrics() const;
+
+  /**
+   * Returns the name used to identify the source of a packet.
+   */
+  static const std::string & GetSourceName(
+    const Referee & referee,
+    const std::string & sender_address);
+
+private:
+  struct SourceState
+  {
+    std::chrono::steady_clock::time_point last_receive_time;
+    std::chrono::steady_clock::duration period;
+    bool period_measured{false};
+  };
+
+  const double failover_periods_;
+  const std::chrono::steady_clock::duration initial_period_;
+  const std::string preferred_source_;
+  const std::chrono::steady_clock::duration failover_margin_;
+  const std::chrono::steady_clock::duration min_dwell_time_;
+  mutable std::mutex mutex_;
+  std::map<std::string, SourceState> sources_;
+  std::optional<uint32_t> last_command_counter_;
+  std::optional<uint64_t> last_packet_timestamp_;
+  int consecutive_outdated_packets_{0};
+  Metrics metrics_;
+
+  void UpdateSource(
+    const std::string & source_name,
+    const std::chrono::steady_clock::time_point receive_time);
+
+  /**
+   * Whether an outdated packet from the primary is too far off to be a reordered packet.
+   */
+  bool IsReset(const Referee & referee) const;
+
+  bool ShouldSwitchTo(
+    const std::string & source_name,
+    const std::chrono::steady_clock::time_point receive_time) const;
+};
+
+}  // namespace ssl_ros_bridge::game_controller_bridge
+
+#endif  // GAME_CONTROLLER_BRIDGE__REFEREE_SOURCE_SELECTOR_HPP_
@@ -0,0 +1,306 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <getopt.h>
+#include <ssl_league_protobufs/ssl_vision_wrapper.pb.h>
+#include <ssl_league_protobufs/ssl_gc_referee_message.pb.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <rclcpp/rclcpp.hpp>
+#include <rosbag2_cpp/reader.hpp>
+#include <rosbag2_storage/storage_filter.hpp>
+#include <ssl_league_msgs/msg/vision_wrapper.hpp>
+#include <ssl_league_msgs/msg/referee.hpp>
+#include "core/log_writer.hpp"
+#include "core/message_conversion.hpp"
+#include "command_line.hpp"
+#include "worker_pool.hpp"
+
+using ssl_ros_bridge::core::EntryType;
+
+// Values for options without a short form
+enum LongOption
+{
+  kVisionTopicOption = 256,
+  kRefereeTopicOption
+};
+
+// Messages per unit of work handed to the worker pool
+constexpr std::size_t kChunkSize = 1024;
+
+const std::string kRefereeTypeName = "ssl_league_msgs/msg/Referee";
+const std::string kVisionTypeName = "ssl_league_msgs/msg/VisionWrapper";
+
+struct ConvertedMessage
+{
+  int64_t received_time_ns;
+  EntryType type;
+  std::string data;
+};
+
+void PrintUsage()
+{
+  std::cout <<
+    R"(
+Usage: bag2log [OPTIONS] BAG
+Export the vision and referee messages of a ROS bag to an SSL log.
+
+BAG - A bag directory or file, such as one recorded from the bridge nodes or written by log2bag
+
+  -o, --output FILE       Log file to write (default: the bag name with a .log extension)
+  -j, --jobs N            Number of conversion threads (default: number of CPU cores)
+  --vision-topic TOPIC    Topic of the vision messages (default: /vision_messages)
+  --referee-topic TOPIC   Topic of the referee messages (default: /referee_messages)
+  -h, --help              Show this message
+)";
+}
+
+/**
+ * Checks that a topic exists in the bag with the expected type.
+ *
+ * @return The number of messages on the topic, or nothing if the bag does not contain it
+ * @throws std::runtime_error if the topic has a different type
+ */
+std::optional<std::size_t> FindTopic(
+  const rosbag2_storage::BagMetadata & metadata, const std::string & topic,
+  const std::string & type_name)
+{
+  std::vector<std::string> candidates;
+  for(const auto & topic_information : metadata.topics_with_message_count) {
+    const auto & topic_metadata = topic_information.topic_metadata;
+    if(topic_metadata.name == topic) {
+      if(topic_metadata.type != type_name) {
+        throw std::runtime_error(
+                topic + " has type " + topic_metadata.type + " instead of " + type_name + ".");
+      }
+      return topic_information.message_count;
+    }
+    if(topic_metadata.type == type_name) {
+      candidates.push_back(topic_metadata.name);
+    }
+  }
+  std::cerr << "The bag does not contain " << topic << '.';
+  if(!candidates.empty()) {
+    std::cerr << " Topics of type " << type_name << ':';
+    for(const auto & candidate : candidates) {
+      std::cerr << ' ' << candidate;
+    }
+  }
+  std::cerr << '\n';
+  return std::nullopt;
+}
+
+template<typename RosType>
+std::string ConvertMessage(const rosbag2_storage::SerializedBagMessage & bag_message)
+{
+  static const rclcpp::Serialization<RosType> serialization;
+  const rclcpp::SerializedMessage serialized_msg(*bag_message.serialized_data);
+  RosType msg;
+  serialization.deserialize_message(&serialized_msg, &msg);
+  return ssl_ros_bridge::message_conversion::toProto(msg).SerializeAsString();
+}
+
+/**
+ * Deserializes, converts, and serializes a chunk of bag messages. Runs on the worker pool.
+ */
+std::vector<ConvertedMessage> ConvertChunk(
+  const std::vector<std::shared_ptr<rosbag2_storage::SerializedBagMessage>> & chunk,
+  const std::string & vision_topic)
+{
+  std::vector<ConvertedMessage> converted_messages;
+  converted_messages.reserve(chunk.size());
+  for(const auto & bag_message : chunk) {
+    if(bag_message->topic_name == vision_topic) {
+      converted_messages.push_back(
+        {bag_message->recv_timestamp, EntryType::Vision2014,
+          ConvertMessage<ssl_league_msgs::msg::VisionWrapper>(*bag_message)});
+    } else {
+      converted_messages.push_back(
+        {bag_message->recv_timestamp, EntryType::Refbox2013,
+          ConvertMessage<ssl_league_msgs::msg::Referee>(*bag_message)});
+    }
+  }
+  return converted_messages;
+}
+
+int main(int argc, char ** argv)
+{
+  std::optional<std::filesystem::path> output_path;
+  std::size_t job_count = std::max(std::thread::hardware_concurrency(), 1u);
+  std::string vision_topic = "/vision_messages";
+  std::string referee_topic = "/referee_messages";
+
+  const option long_options[] = {
+    {"output", required_argument, nullptr, 'o'},
+    {"jobs", required_argument, nullptr, 'j'},
+    {"vision-topic", required_argument, nullptr, kVisionTopicOption},
+    {"referee-topic", required_argument, nullptr, kRefereeTopicOption},
+    {"help", no_argument, nullptr, 'h'},
+    {nullptr, 0, nullptr, 0}
+  };
+  int opt;
+  while((opt = getopt_long(argc, argv, "o:j:h", long_options, nullptr)) != -1) {
+    switch(opt) {
+      case 'o':
+        output_path = optarg;
+        break;
+      case 'j':
+        job_count = ssl_ros_bridge::ParseUnsigned(optarg).value_or(0);
+        if(job_count == 0) {
+          std::cerr << "Invalid number of jobs: " << optarg << '\n';
+          return 1;
+        }
+        break;
+      case kVisionTopicOption:
+        vision_topic = optarg;
+        break;
+      case kRefereeTopicOption:
+        referee_topic = optarg;
+        break;
+      case 'h':
+        PrintUsage();
+        return 0;
+      default:
+        PrintUsage();
+        return 1;
+    }
+  }
+
+  if(argc - optind != 1) {
+    PrintUsage();
+    return 1;
+  }
+  if(vision_topic == referee_topic) {
+    std::cerr << "The vision and referee topics must differ.\n";
+    return 1;
+  }
+  const std::filesystem::path bag_path = argv[optind];
+  if(!output_path) {
+    // Bags are usually directories, whose names have no extension to replace
+    auto bag_name = bag_path.filename();
+    if(bag_name.empty()) {
+      bag_name = bag_path.parent_path().filename();
+    }
+    output_path = bag_name.replace_extension(".log");
+  }
+
+  const auto start_time = std::chrono::steady_clock::now();
+  uint64_t vision_count = 0;
+  uint64_t referee_count = 0;
+  uint64_t entry_count = 0;
+  try {
+    rosbag2_cpp::Reader reader;
+    reader.open(bag_path.string());
+
+    const auto & metadata = reader.get_metadata();
+    const auto vision_message_count = FindTopic(metadata, vision_topic, kVisionTypeName);
+    const auto referee_message_count = FindTopic(metadata, referee_topic, kRefereeTypeName);
+    if(!vision_message_count && !referee_message_count) {
+      std::cerr << "Nothing to export. Choose the topics with --vision-topic and " <<
+        "--referee-topic.\n";
+      return 1;
+    }
+    const auto total_message_count =
+      vision_message_count.value_or(0) + referee_message_count.value_or(0);
+
+    rosbag2_storage::StorageFilter filter;
+    if(vision_message_count) {
+      filter.topics.push_back(vision_topic);
+    }
+    if(referee_message_count) {
+      filter.topics.push_back(referee_topic);
+    }
+    reader.set_filter(filter);
+
+    // The bag is read far faster than the disk is written, so nothing may be dropped
+    ssl_ros_bridge::core::LogWriter writer(
+      *output_path, nullptr, 64 << 20,
+      ssl_ros_bridge::core::LogWriter::FullBufferPolicy::Wait);
+    ssl_ros_bridge::WorkerPool worker_pool(job_count);
+
+    // Chunks are converted in parallel but written in bag order. Limiting how many are in flight
+    // bounds memory use when the disk is slower than the workers.
+    const auto max_pending_chunks = 2 * job_count;
+    std::deque<std::future<std::vector<ConvertedMessage>>> pending_chunks;
+    uint64_t message_count = 0;
+    auto last_render_time = std::chrono::steady_clock::now();
+    ssl_ros_bridge::RenderProgressBar(0.0);
+    while(true) {
+      while(reader.has_next() && pending_chunks.size() < max_pending_chunks) {
+        std::vector<std::shared_ptr<rosbag2_storage::SerializedBagMessage>> chunk;
+        chunk.reserve(kChunkSize);
+        while(chunk.size() < kChunkSize && reader.has_next()) {
+          chunk.push_back(reader.read_next());
+        }
+        pending_chunks.push_back(
+          worker_pool.Submit(
+            [chunk = std::move(chunk), &vision_topic]() {
+              return ConvertChunk(chunk, vision_topic);
+            }));
+      }
+      if(pending_chunks.empty()) {
+        break;
+      }
+      const auto converted_messages = pending_chunks.front().get();
+      pending_chunks.pop_front();
+      for(const auto & converted_message : converted_messages) {
+        const std::span<const uint8_t> data(
+          reinterpret_cast<const uint8_t *>(converted_message.data.data()),
+          converted_message.data.size());
+        if(!writer.Write(converted_message.received_time_ns, converted_message.type, data)) {
+          throw std::runtime_error("Could not write " + output_path->string() + ".");
+        }
+        (converted_message.type == EntryType::Vision2014 ? vision_count : referee_count)++;
+      }
+      message_count += converted_messages.size();
+      const auto now = std::chrono::steady_clock::now();
+      if(total_message_count > 0 && now - last_render_time > std::chrono::milliseconds(100)) {
+        ssl_ros_bridge::RenderProgressBar(static_cast<double>(message_count) / total_message_count);
+        last_render_time = now;
+      }
+    }
+    writer.Close();
+    ssl_ros_bridge::RenderProgressBar(1.0);
+    std::cout << "\n\n";
+    entry_count = writer.GetEntryCount();
+  } catch (const std::runtime_error & e) {
+    std::cerr << "\nCould not export " << bag_path << ": " << e.what() << '\n';
+    return 1;
+  }
+  const std::chrono::duration<double> elapsed_time = std::chrono::steady_clock::now() - start_time;
+
+  std::cout << "Referee messages: " << referee_count << '\n';
+  std::cout << "Vision messages:  " << vision_count << '\n';
+  std::cout << "Wrote " << entry_count << " entries to " << output_path->string() << " in " <<
+    elapsed_time.count() << " s.\n";
+  return 0;
+}
@@ -0,0 +1,174 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "bag_writer_options.hpp"
+#include <unistd.h>
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+#include <rosbag2_storage/storage_options.hpp>
+
+namespace ssl_ros_bridge
+{
+
+namespace
+{
+
+const char * GetMcapCompressionName(const BagCompression compression)
+{
+  switch(compression) {
+    case BagCompression::Zstd:
+      return "Zstd";
+    case BagCompression::Lz4:
+      return "Lz4";
+    default:
+      return "None";
+  }
+}
+
+/**
+ * The MCAP plugin only takes chunk settings from a storage config file. Each call gets its own
+ * file, because batch conversions open several bags at once.
+ */
+BagStorageConfig WriteMcapConfig(const BagWriterOptions & options)
+{
+  constexpr std::string_view kSuffix = ".yaml";
+  auto name = (std::filesystem::temp_directory_path() / "log2bag_mcap_XXXXXX").string();
+  name += kSuffix;
+  const auto fd = mkstemps(name.data(), static_cast<int>(kSuffix.size()));
+  if(fd < 0) {
+    throw std::system_error(errno, std::generic_category(), "Could not create MCAP storage config");
+  }
+  close(fd);
+  BagStorageConfig storage_config(name);
+  std::ofstream config(storage_config.GetPath());
+  config << "compression: \"" << GetMcapCompressionName(options.compression) << "\"\n";
+  if(options.compression != BagCompression::None) {
+    // Compressing every chunk keeps the output size predictable for benchmarking
+    config << "forceCompression: true\n";
+  }
+  if(options.chunk_size) {
+    config << "chunkSize: " << *options.chunk_size << '\n';
+  }
+  config.close();
+  if(!config) {
+    throw std::runtime_error("Could not write MCAP storage config to " + name);
+  }
+  return storage_config;
+}
+
+}  // namespace
+
+BagStorageConfig::BagStorageConfig(std::filesystem::path path)
+: path_(std::move(path))
+{
+}
+
+BagStorageConfig::~BagStorageConfig()
+{
+  Remove();
+}
+
+BagStorageConfig::BagStorageConfig(BagStorageConfig && other) noexcept
+: path_(std::exchange(other.path_, {}))
+{
+}
+
+BagStorageConfig & BagStorageConfig::operator=(BagStorageConfig && other) noexcept
+{
+  if(this != &other) {
+    Remove();
+    path_ = std::exchange(other.path_, {});
+  }
+  return *this;
+}
+
+void BagStorageConfig::Remove() noexcept
+{
+  if(!path_.empty()) {
+    std::error_code error;
+    std::filesystem::remove(path_, error);
+    path_.clear();
+  }
+}
+
+std::optional<BagCompression> ParseBagCompression(std::string_view name)
+{
+  if(name == "none") {
+    return BagCompression::None;
+  }
+  if(name == "zstd") {
+    return BagCompression::Zstd;
+  }
+  if(name == "lz4") {
+    return BagCompression::Lz4;
+  }
+  return std::nullopt;
+}
+
+BagStorageConfig OpenBagWriter(
+  rosbag2_cpp::Writer & writer, const std::filesystem::path & uri,
+  const BagWriterOptions & options)
+{
+  rosbag2_storage::StorageOptions storage_options;
+  storage_options.uri = uri.string();
+  storage_options.storage_id = options.storage_id;
+  storage_options.max_bagfile_size = options.max_bagfile_size;
+  storage_options.max_bagfile_duration = options.max_bagfile_duration;
+  if(options.max_cache_size) {
+    storage_options.max_cache_size = *options.max_cache_size;
+  }
+
+  const auto uses_chunk_options = options.compression != BagCompression::None ||
+    options.chunk_size.has_value();
+  if(!uses_chunk_options) {
+    writer.open(storage_options);
+    return {};
+  }
+  if(storage_options.storage_id.empty()) {
+    storage_options.storage_id = "mcap";
+  } else if(storage_options.storage_id != "mcap") {
+    throw std::runtime_error("Chunk compression and chunk size require the mcap storage plugin.");
+  }
+  auto storage_config = WriteMcapConfig(options);
+  storage_options.storage_config_uri = storage_config.GetPath().string();
+  writer.open(storage_options);
+  return storage_config;
+}
+
+std::uintmax_t GetBagSize(const std::filesystem::path & uri)
+{
+  std::error_code error;
+  if(std::filesystem::is_regular_file(uri, error)) {
+    return std::filesystem::file_size(uri, error);
+  }
+  std::uintmax_t size = 0;
+  for(const auto & file : std::filesystem::recursive_directory_iterator(uri, error)) {
+    if(file.is_regular_file(error)) {
+      size += file.file_size(error);
+    }
+  }
+  return size;
+}
+
+}  // namespace ssl_ros_bridge
@@ -0,0 +1,107 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef LOG2BAG__BAG_WRITER_OPTIONS_HPP_
+#define LOG2BAG__BAG_WRITER_OPTIONS_HPP_
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <rosbag2_cpp/writer.hpp>
+
+namespace ssl_ros_bridge
+{
+
+enum class BagCompression
+{
+  None,
+  Zstd,
+  Lz4
+};
+
+std::optional<BagCompression> ParseBagCompression(std::string_view name);
+
+/**
+ * Output settings for converted bags. Zero or unset values keep the rosbag2 defaults.
+ */
+struct BagWriterOptions
+{
+  // Storage plugin, such as "mcap" or "sqlite3"
+  std::string storage_id;
+  // Chunk compression, which only the MCAP plugin supports
+  BagCompression compression{BagCompression::None};
+  std::optional<uint64_t> chunk_size;
+  std::optional<uint64_t> max_cache_size;
+  uint64_t max_bagfile_size{0};
+  uint64_t max_bagfile_duration{0};
+};
+
+/**
+ * Storage config file written for a bag. The writer reads it again whenever it starts a new split
+ * file, so it must outlive the writer. The file is removed on destruction.
+ */
+class BagStorageConfig {
+public:
+  BagStorageConfig() = default;
+
+  explicit BagStorageConfig(std::filesystem::path path);
+
+  ~BagStorageConfig();
+
+  BagStorageConfig(BagStorageConfig && other) noexcept;
+  BagStorageConfig & operator=(BagStorageConfig && other) noexcept;
+
+  BagStorageConfig(const BagStorageConfig &) = delete;
+  BagStorageConfig & operator=(const BagStorageConfig &) = delete;
+
+  /**
+   * Returns the path of the config file, or an empty path if the bag needs none.
+   */
+  const std::filesystem::path & GetPath() const
+  {
+    return path_;
+  }
+
+private:
+  void Remove() noexcept;
+
+  std::filesystem::path path_;
+};
+
+/**
+ * Opens a bag for writing at uri with the given options.
+ *
+ * @return Storage config the writer uses, which must be kept until the writer is closed
+ * @throws std::runtime_error if the options are not supported by the storage plugin
+ */
+[[nodiscard]] BagStorageConfig OpenBagWriter(
+  rosbag2_cpp::Writer & writer, const std::filesystem::path & uri,
+  const BagWriterOptions & options);
+
+/**
+ * Returns the total size of the files making up a bag, including split files and metadata.
+ */
+std::uintmax_t GetBagSize(const std::filesystem::path & uri);
+
+}  // namespace ssl_ros_bridge
+
+#endif  // LOG2BAG__BAG_WRITER_OPTIONS_HPP_
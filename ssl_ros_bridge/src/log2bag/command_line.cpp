@@ -0,0 +1,60 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "command_line.hpp"
+#include <algorithm>
+#include <cctype>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+
+namespace ssl_ros_bridge
+{
+
+std::optional<uint64_t> ParseUnsigned(const std::string & text)
+{
+  if(text.empty() || !std::isdigit(static_cast<unsigned char>(text.front()))) {
+    return std::nullopt;
+  }
+  try {
+    std::size_t length = 0;
+    const auto value = std::stoull(text, &length);
+    if(length != text.size()) {
+      return std::nullopt;
+    }
+    return value;
+  } catch (const std::logic_error &) {
+    return std::nullopt;
+  }
+}
+
+void RenderProgressBar(const double progress)
+{
+  constexpr auto bar_width = 20;
+  const auto percent = static_cast<int>(std::clamp(progress, 0.0, 1.0) * 100);
+  const auto num_filled_chars = (percent * bar_width) / 100;
+  std::cout << "\r[";
+  std::fill_n(std::ostream_iterator<char>(std::cout), num_filled_chars, '=');
+  std::fill_n(std::ostream_iterator<char>(std::cout), bar_width - num_filled_chars, ' ');
+  std::cout << "] " << percent << '%';
+  std::cout.flush();
+}
+
+}  // namespace ssl_ros_bridge
@@ -1,4 +1,4 @@
-// Copyright 2025 A Team
+// Copyright 2026 A Team
 //
 // Permission is hereby granted, free of charge, to any person obtaining a copy
 // of this software and associated documentation files (the "Software"), to deal
@@ -18,56 +18,30 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
-#ifndef LOG2BAG__LOG_READER_HPP_
-#define LOG2BAG__LOG_READER_HPP_
+#ifndef LOG2BAG__COMMAND_LINE_HPP_
+#define LOG2BAG__COMMAND_LINE_HPP_
 
-#include <ssl_league_protobufs/ssl_vision_wrapper.pb.h>
-#include <ssl_league_protobufs/ssl_gc_referee_message.pb.h>
-#include <istream>
+#include <cstdint>
 #include <optional>
-#include <unordered_map>
-#include <variant>
+#include <string>
 
 namespace ssl_ros_bridge
 {
 
-enum class EntryType : int32_t
-{
-  Blank = 0,
-  Unknown = 1,
-  Vision2010 = 2,
-  Refbox2013 = 3,
-  Vision2014 = 4,
-  VisionTracker2020 = 5,
-  Index2021 = 6
-};
-
-struct LogEntry
-{
-  int64_t received_time_ns;
-  std::variant<std::monostate, Referee, SSL_WrapperPacket> message;
-};
-
-class LogReader {
-public:
-  explicit LogReader(std::istream & input);
-
-  std::optional<LogEntry> GetNextMessage();
-
-  const std::unordered_map<EntryType, uint64_t> & GetEntryTypeCounts() const
-  {
-    return entry_type_counts;
-  }
-
-private:
-  std::istream & input_stream;
-  std::unordered_map<EntryType, uint64_t> entry_type_counts;
-
-  void CheckHeader();
+/**
+ * Parses a whole string as a non-negative integer.
+ *
+ * @return nullopt if the text is not a number, has trailing characters, or is out of range
+ */
+std::optional<uint64_t> ParseUnsigned(const std::string & text);
 
-  LogEntry ExtractNextEntry();
-};
+/**
+ * Redraws a 20 character progress bar in place on stdout.
+ *
+ * @param progress Fraction done, clamped to [0, 1]
+ */
+void RenderProgressBar(const double progress);
 
 }  // namespace ssl_ros_bridge
 
-#endif  // LOG2BAG__LOG_READER_HPP_
+#endif  // LOG2BAG__COMMAND_LINE_HPP_
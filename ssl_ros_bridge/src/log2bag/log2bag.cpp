@@ -18,107 +18,416 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <getopt.h>
+#include <glob.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <filesystem>
-#include <fstream>
-#include <rclcpp/rclcpp.hpp>
-#include <ssl_league_msgs/msg/vision_wrapper.hpp>
-#include <ssl_league_msgs/msg/referee.hpp>
-#include <rosbag2_cpp/writer.hpp>
-#include "core/message_conversion.hpp"
-#include "log_reader.hpp"
-
-template<typename ProtoType, typename RosType>
-void WriteMessageIfExists(
-  const ssl_ros_bridge::LogEntry & entry, const std::string & topic,
-  const std::string & type_name, rosbag2_cpp::Writer & writer,
-  typename rclcpp::Serialization<RosType> & serialization)
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "bag_writer_options.hpp"
+#include "command_line.hpp"
+#include "log_converter.hpp"
+#include "worker_pool.hpp"
+
+using ssl_ros_bridge::core::EntryType;
+
+// Values for options without a short form
+enum LongOption
 {
-  if(!std::holds_alternative<ProtoType>(entry.message)) {
-    return;
-  }
-  const auto msg =
-    ssl_ros_bridge::message_conversion::fromProto(std::get<ProtoType>(entry.message));
-  auto serialized_msg = std::make_shared<rclcpp::SerializedMessage>();
-  serialization.serialize_message(&msg, serialized_msg.get());
-  rclcpp::Time time(entry.received_time_ns);
-  writer.write(serialized_msg, topic, type_name, time);
-}
+  kStorageOption = 256,
+  kCompressionOption,
+  kChunkSizeOption,
+  kCacheSizeOption,
+  kSplitSizeOption,
+  kSplitDurationOption,
+  kFollowTimeoutOption
+};
+
+struct LogJob
+{
+  std::filesystem::path log_path;
+  std::filesystem::path bag_path;
+  std::uintmax_t log_size;
+  std::atomic<double> progress{0.0};
+  std::optional<ssl_ros_bridge::ConversionResult> result;
+  // Set instead of result when the log was not converted
+  std::string status;
+};
 
 void PrintUsage()
 {
   std::cout <<
     R"(
-Usage: log2bag FILE
-Convert SSL log file to ROS bag.
+Usage: log2bag [OPTIONS] INPUT...
+Convert SSL log files to ROS bags.
+
+INPUT - An SSL log file, a directory to search for logs, or a glob pattern. Logs may be
+        compressed with gzip or zstd. pcap and pcapng captures of the vision and referee
+        multicast traffic are converted as well. Logs whose bag already exists are skipped.
 
-FILE - The SSL log file to convert
+  -o, --output-dir DIR      Directory to write bags to (default: current directory)
+  -p, --parallel N          Number of logs converted at once (default: half the CPU cores)
+  -j, --jobs N              Number of conversion threads (default: number of CPU cores)
+  -s, --start SECONDS       Skip messages received before this, relative to the first entry
+  -e, --end SECONDS         Stop at messages received this long after the first entry
+  -f, --follow              Keep converting a single uncompressed log while it is written, until
+                            its writer appends the index or it stops growing
+  --follow-timeout SECONDS  How long a followed log may stop growing (default: 10, 0 waits forever)
+  --storage ID              Bag storage plugin, such as mcap or sqlite3
+  --compression TYPE        Chunk compression: none, zstd or lz4 (mcap only, default: none)
+  --chunk-size BYTES        Size of compressed chunks (mcap only)
+  --cache-size BYTES        Bytes of messages buffered in memory before they are written
+  --split-size BYTES        Start a new bag file after this many bytes
+  --split-duration SECONDS  Start a new bag file after this much recorded time
+  -h, --help                Show this message
 )";
 }
 
-void RenderProgressBar(uintmax_t bytes_read, uintmax_t bytes_total)
+bool IsLogFile(const std::filesystem::path & path)
+{
+  const auto name = path.filename().string();
+  return name.ends_with(".log") || name.ends_with(".log.gz") || name.ends_with(".log.zst") ||
+         name.ends_with(".pcap") || name.ends_with(".pcapng");
+}
+
+/**
+ * Expands files, directories, and glob patterns into a sorted list of logs.
+ */
+std::optional<std::vector<std::filesystem::path>> FindLogs(const std::vector<std::string> & inputs)
 {
-  constexpr auto bar_width = 20;
-  const auto percent = (bytes_read * 100) / bytes_total;
-  const auto num_filled_chars = (percent * bar_width) / 100;
-  std::cout << "\r[";
-  std::fill_n(std::ostream_iterator<char>(std::cout), num_filled_chars, '=');
-  std::fill_n(std::ostream_iterator<char>(std::cout), bar_width - num_filled_chars, ' ');
-  std::cout << "] " << percent << '%';
-  std::cout.flush();
+  std::set<std::filesystem::path> log_paths;
+  for(const auto & input : inputs) {
+    if(std::filesystem::is_directory(input)) {
+      for(const auto & file : std::filesystem::recursive_directory_iterator(input)) {
+        if(file.is_regular_file() && IsLogFile(file.path())) {
+          log_paths.insert(file.path());
+        }
+      }
+      continue;
+    }
+    if(std::filesystem::exists(input)) {
+      log_paths.insert(input);
+      continue;
+    }
+    glob_t matches;
+    if(glob(input.c_str(), 0, nullptr, &matches) != 0) {
+      globfree(&matches);
+      std::cerr << "No logs found for " << input << '\n';
+      return std::nullopt;
+    }
+    for(std::size_t i = 0; i < matches.gl_pathc; ++i) {
+      log_paths.insert(matches.gl_pathv[i]);
+    }
+    globfree(&matches);
+  }
+  return std::vector<std::filesystem::path>(log_paths.begin(), log_paths.end());
+}
+
+std::filesystem::path GetBagName(const std::filesystem::path & log_path)
+{
+  auto name = log_path.filename();
+  // Drop the .gz or .zst extension along with .log
+  if(name.extension() == ".gz" || name.extension() == ".zst") {
+    name = name.stem();
+  }
+  return name.stem();
+}
+
+/**
+ * Converts into a hidden directory and moves the bag into place once it is complete, so an
+ * interrupted batch can be resumed by skipping bags which exist.
+ */
+void ConvertLogJob(
+  LogJob & job, const ssl_ros_bridge::ConversionOptions & options,
+  ssl_ros_bridge::WorkerPool & worker_pool)
+{
+  const auto partial_directory = job.bag_path.parent_path() /
+    ("." + job.bag_path.filename().string() + ".partial");
+  try {
+    std::filesystem::remove_all(partial_directory);
+    std::filesystem::create_directories(partial_directory);
+    const auto partial_bag_path = partial_directory / job.bag_path.filename();
+    job.result = ssl_ros_bridge::ConvertLog(
+      job.log_path, partial_bag_path, options, worker_pool, job.progress);
+    std::filesystem::rename(partial_bag_path, job.bag_path);
+    std::filesystem::remove_all(partial_directory);
+  } catch (const std::exception & e) {
+    job.result.reset();
+    job.status = std::string("failed: ") + e.what();
+    job.progress = 1.0;
+    std::error_code error;
+    std::filesystem::remove_all(partial_directory, error);
+  }
+}
+
+void PrintSummary(const std::vector<std::unique_ptr<LogJob>> & jobs)
+{
+  std::size_t name_width = 3;
+  for(const auto & job : jobs) {
+    name_width = std::max(name_width, job->log_path.filename().string().size());
+  }
+  const std::vector<std::pair<const char *, EntryType>> columns = {
+    {"Referee", EntryType::Refbox2013},
+    {"Vision", EntryType::Vision2014},
+    {"Blank", EntryType::Blank},
+    {"Unknown", EntryType::Unknown},
+    {"Vision2010", EntryType::Vision2010},
+    {"Tracker", EntryType::VisionTracker2020},
+    {"Index", EntryType::Index2021}
+  };
+  constexpr int count_width = 11;
+  std::cout << std::left << std::setw(name_width) << "Log" << std::right;
+  for(const auto & [title, type] : columns) {
+    std::cout << std::setw(count_width) << title;
+  }
+  std::cout << std::setw(10) << "Log MB" << std::setw(10) << "Bag MB" << std::setw(10) <<
+    "Write s" << "  Status\n";
+  const auto flags = std::cout.flags();
+  const auto precision = std::cout.precision();
+  std::cout << std::fixed << std::setprecision(1);
+  for(const auto & job : jobs) {
+    std::cout << std::left << std::setw(name_width) << job->log_path.filename().string() <<
+      std::right;
+    if(!job->result) {
+      std::cout << std::string(columns.size() * count_width + 30, ' ') << "  " << job->status <<
+        '\n';
+      continue;
+    }
+    for(const auto & [title, type] : columns) {
+      std::cout << std::setw(count_width) << job->result->entry_type_counts.at(type);
+    }
+    std::cout << std::setw(10) << job->result->log_bytes / 1e6 << std::setw(10) <<
+      ssl_ros_bridge::GetBagSize(job->bag_path) / 1e6 << std::setw(10) <<
+      job->result->write_time.count() << "  converted\n";
+  }
+  std::cout.flags(flags);
+  std::cout.precision(precision);
 }
 
 int main(int argc, char ** argv)
 {
-  if(argc != 2) {
+  std::size_t job_count = std::max(std::thread::hardware_concurrency(), 1u);
+  std::size_t parallel_count = std::max(std::thread::hardware_concurrency() / 2, 1u);
+  std::filesystem::path output_directory = ".";
+  ssl_ros_bridge::ConversionOptions options;
+  options.follow_timeout = std::chrono::seconds(10);
+
+  const option long_options[] = {
+    {"jobs", required_argument, nullptr, 'j'},
+    {"start", required_argument, nullptr, 's'},
+    {"end", required_argument, nullptr, 'e'},
+    {"follow", no_argument, nullptr, 'f'},
+    {"follow-timeout", required_argument, nullptr, kFollowTimeoutOption},
+    {"storage", required_argument, nullptr, kStorageOption},
+    {"compression", required_argument, nullptr, kCompressionOption},
+    {"chunk-size", required_argument, nullptr, kChunkSizeOption},
+    {"cache-size", required_argument, nullptr, kCacheSizeOption},
+    {"split-size", required_argument, nullptr, kSplitSizeOption},
+    {"split-duration", required_argument, nullptr, kSplitDurationOption},
+    {"output-dir", required_argument, nullptr, 'o'},
+    {"parallel", required_argument, nullptr, 'p'},
+    {"help", no_argument, nullptr, 'h'},
+    {nullptr, 0, nullptr, 0}
+  };
+  int opt;
+  while((opt = getopt_long(argc, argv, "j:s:e:fo:p:h", long_options, nullptr)) != -1) {
+    switch(opt) {
+      case 'j':
+      case 'p':
+        {
+          const auto count = ssl_ros_bridge::ParseUnsigned(optarg).value_or(0);
+          if(count == 0) {
+            std::cerr << "Invalid number of " << (opt == 'j' ? "jobs" : "parallel logs") << ": " <<
+              optarg << '\n';
+            return 1;
+          }
+          (opt == 'j' ? job_count : parallel_count) = count;
+          break;
+        }
+      case 'o':
+        output_directory = optarg;
+        break;
+      case 's':
+      case 'e':
+        try {
+          (opt == 's' ? options.start_seconds : options.end_seconds) = std::stod(optarg);
+        } catch (const std::logic_error &) {
+          std::cerr << "Invalid time: " << optarg << '\n';
+          return 1;
+        }
+        break;
+      case 'f':
+        options.follow = true;
+        break;
+      case kFollowTimeoutOption:
+        try {
+          const auto seconds = std::stod(optarg);
+          if(seconds < 0.0) {
+            throw std::invalid_argument("negative timeout");
+          }
+          options.follow_timeout = std::chrono::milliseconds(static_cast<int64_t>(seconds * 1e3));
+        } catch (const std::logic_error &) {
+          std::cerr << "Invalid timeout: " << optarg << '\n';
+          return 1;
+        }
+        break;
+      case kStorageOption:
+        options.bag_options.storage_id = optarg;
+        break;
+      case kCompressionOption:
+        {
+          const auto compression = ssl_ros_bridge::ParseBagCompression(optarg);
+          if(!compression) {
+            std::cerr << "Invalid compression: " << optarg << '\n';
+            return 1;
+          }
+          options.bag_options.compression = *compression;
+          break;
+        }
+      case kChunkSizeOption:
+      case kCacheSizeOption:
+      case kSplitSizeOption:
+      case kSplitDurationOption:
+        {
+          const auto value = ssl_ros_bridge::ParseUnsigned(optarg);
+          if(!value) {
+            std::cerr << "Invalid number: " << optarg << '\n';
+            return 1;
+          }
+          if(opt == kChunkSizeOption) {
+            options.bag_options.chunk_size = *value;
+          } else if(opt == kCacheSizeOption) {
+            options.bag_options.max_cache_size = *value;
+          } else if(opt == kSplitSizeOption) {
+            options.bag_options.max_bagfile_size = *value;
+          } else {
+            options.bag_options.max_bagfile_duration = *value;
+          }
+          break;
+        }
+      case 'h':
+        PrintUsage();
+        return 0;
+      default:
+        PrintUsage();
+        return 1;
+    }
+  }
+
+  if(optind == argc) {
     PrintUsage();
     return 1;
   }
 
-  std::filesystem::path log_path = argv[1];
-
-  std::ifstream stream(log_path, std::ios::binary);
-  if(!stream.is_open()) {
-    std::cerr << "Could not open log file.\n";
+  const auto log_paths = FindLogs(std::vector<std::string>(argv + optind, argv + argc));
+  if(!log_paths) {
+    return 1;
+  }
+  if(log_paths->empty()) {
+    std::cerr << "No logs found.\n";
+    return 1;
+  }
+  if(options.follow && log_paths->size() != 1) {
+    std::cerr << "--follow converts a single log, but " << log_paths->size() << " were found.\n";
     return 1;
   }
 
-  std::error_code errcode;
-  const auto log_file_size = std::filesystem::file_size(log_path, errcode);
-  if(errcode) {
-    std::cerr << "Could not determine log file size: " << errcode.message() << '\n';
+  std::vector<std::unique_ptr<LogJob>> jobs;
+  std::map<std::filesystem::path, std::filesystem::path> bag_sources;
+  for(const auto & log_path : *log_paths) {
+    auto job = std::make_unique<LogJob>();
+    job->log_path = log_path;
+    job->bag_path = output_directory / GetBagName(log_path);
+    std::error_code error;
+    job->log_size = std::filesystem::file_size(log_path, error);
+    if(error) {
+      job->log_size = 0;
+    }
+    const auto [existing, inserted] = bag_sources.emplace(job->bag_path, log_path);
+    if(!inserted) {
+      std::cerr << log_path << " and " << existing->second << " would both be converted to " <<
+        job->bag_path << ".\n";
+      return 1;
+    }
+    if(std::filesystem::exists(job->bag_path)) {
+      job->status = "skipped, bag exists";
+      job->progress = 1.0;
+    }
+    jobs.push_back(std::move(job));
+  }
+
+  std::error_code error;
+  std::filesystem::create_directories(output_directory, error);
+  if(error) {
+    std::cerr << "Could not create " << output_directory << ": " << error.message() << '\n';
     return 1;
   }
 
-  ssl_ros_bridge::LogReader reader(stream);
+  const auto start_time = std::chrono::steady_clock::now();
+  parallel_count = std::min(parallel_count, jobs.size());
+  // Each log's writer is limited to its share of the chunks in flight, which bounds memory use
+  // when the writers are slower than the workers
+  options.max_pending_chunks = std::max<std::size_t>(2 * job_count / parallel_count, 2);
+  std::vector<std::future<void>> conversions;
+  {
+    ssl_ros_bridge::WorkerPool chunk_pool(job_count);
+    ssl_ros_bridge::WorkerPool log_pool(parallel_count);
+    for(auto & job : jobs) {
+      if(job->status.empty()) {
+        conversions.push_back(
+          log_pool.Submit(
+            [&job = *job, &options, &chunk_pool]() {
+              ConvertLogJob(job, options, chunk_pool);
+            }));
+      }
+    }
 
-  auto writer = std::make_unique<rosbag2_cpp::Writer>();
-  writer->open(log_path.stem().string());
+    uintmax_t total_size = 0;
+    for(const auto & job : jobs) {
+      total_size += job->log_size;
+    }
+    for(auto & conversion : conversions) {
+      do {
+        double converted_size = 0.0;
+        for(const auto & job : jobs) {
+          converted_size += job->progress * job->log_size;
+        }
+        ssl_ros_bridge::RenderProgressBar(total_size == 0 ? 1.0 : converted_size / total_size);
+      } while(conversion.wait_for(std::chrono::milliseconds(100)) != std::future_status::ready);
+    }
+    ssl_ros_bridge::RenderProgressBar(1.0);
+    std::cout << "\n\n";
+  }
+  const std::chrono::duration<double> elapsed_time = std::chrono::steady_clock::now() - start_time;
 
-  rclcpp::Serialization<ssl_league_msgs::msg::Referee> referee_serialization;
-  rclcpp::Serialization<ssl_league_msgs::msg::VisionWrapper> vision_serialization;
+  PrintSummary(jobs);
 
-  while(const auto entry = reader.GetNextMessage()) {
-    RenderProgressBar(stream.tellg(), log_file_size);
-    WriteMessageIfExists<Referee, ssl_league_msgs::msg::Referee>(*entry, "/referee_messages",
-      "ssl_league_msgs/msg/Referee", *writer, referee_serialization);
-    WriteMessageIfExists<SSL_WrapperPacket, ssl_league_msgs::msg::VisionWrapper>(*entry,
-      "/vision_messages", "ssl_league_msgs/msg/VisionWrapper", *writer, vision_serialization);
+  uint64_t converted_bytes = 0;
+  std::size_t converted_count = 0;
+  std::size_t failed_count = 0;
+  for(const auto & job : jobs) {
+    if(job->result) {
+      converted_bytes += job->result->log_bytes;
+      converted_count++;
+    } else if(job->status.starts_with("failed")) {
+      failed_count++;
+    }
   }
-  std::cout << "\n\n";
-
-  const auto type_stats = reader.GetEntryTypeCounts();
-
-  std::cout << "Translated entries:\n";
-  std::cout << "\tRefbox 2013: " << type_stats.at(ssl_ros_bridge::EntryType::Refbox2013) << '\n';
-  std::cout << "\tVision 2014: " << type_stats.at(ssl_ros_bridge::EntryType::Vision2014) << '\n';
-  std::cout << '\n';
-  std::cout << "Skipped entries:\n";
-  std::cout << "\tBlank: " << type_stats.at(ssl_ros_bridge::EntryType::Blank) << '\n';
-  std::cout << "\tUnknown: " << type_stats.at(ssl_ros_bridge::EntryType::Unknown) << '\n';
-  std::cout << "\tVision 2010: " << type_stats.at(ssl_ros_bridge::EntryType::Vision2010) << '\n';
-  std::cout << "\tVision Tracker 2020: " <<
-    type_stats.at(ssl_ros_bridge::EntryType::VisionTracker2020) << '\n';
-  std::cout << "\tIndex 2021: " << type_stats.at(ssl_ros_bridge::EntryType::Index2021) << '\n';
-
-  return 0;
+  const auto megabytes = converted_bytes / 1e6;
+  std::cout << "\nConverted " << converted_count << " of " << jobs.size() << " logs (" <<
+    megabytes << " MB) in " << elapsed_time.count() << " s (" <<
+    megabytes / elapsed_time.count() << " MB/s) using " << job_count << " threads.\n";
+
+  return failed_count == 0 ? 0 : 1;
 }
@@ -0,0 +1,240 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "log_converter.hpp"
+#include <ssl_league_protobufs/ssl_vision_wrapper.pb.h>
+#include <ssl_league_protobufs/ssl_gc_referee_message.pb.h>
+#include <deque>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <rclcpp/rclcpp.hpp>
+#include <ssl_league_msgs/msg/vision_wrapper.hpp>
+#include <ssl_league_msgs/msg/referee.hpp>
+#include <rosbag2_cpp/writer.hpp>
+#include "core/decompressing_source.hpp"
+#include "core/following_file_source.hpp"
+#include "core/log_index.hpp"
+#include "core/mapped_file.hpp"
+#include "core/message_conversion.hpp"
+#include "core/pcap_log_source.hpp"
+
+namespace ssl_ros_bridge
+{
+
+namespace
+{
+
+// Entries per unit of work handed to the worker pool
+constexpr std::size_t kChunkSize = 1024;
+
+const std::string kRefereeTopic = "/referee_messages";
+const std::string kRefereeTypeName = "ssl_league_msgs/msg/Referee";
+const std::string kVisionTopic = "/vision_messages";
+const std::string kVisionTypeName = "ssl_league_msgs/msg/VisionWrapper";
+
+struct ConvertedEntry
+{
+  int64_t received_time_ns;
+  const std::string * topic;
+  const std::string * type_name;
+  std::shared_ptr<rclcpp::SerializedMessage> serialized_msg;
+};
+
+template<typename ProtoType, typename RosType>
+void ConvertMessage(
+  const core::LogEntry & entry, const std::string & topic,
+  const std::string & type_name, std::vector<ConvertedEntry> & converted_entries)
+{
+  ProtoType proto_msg;
+  if(!proto_msg.ParseFromArray(entry.data.data(), entry.data.size())) {
+    std::cerr << "Failed to parse protobuf message\n";
+    return;
+  }
+  const auto msg = message_conversion::fromProto(proto_msg);
+  static const rclcpp::Serialization<RosType> serialization;
+  auto serialized_msg = std::make_shared<rclcpp::SerializedMessage>();
+  serialization.serialize_message(&msg, serialized_msg.get());
+  converted_entries.push_back({entry.received_time_ns, &topic, &type_name, serialized_msg});
+}
+
+/**
+ * Parses, converts, and serializes a chunk of entries. Runs on the worker pool.
+ */
+std::vector<ConvertedEntry> ConvertChunk(const std::vector<core::LogEntry> & chunk)
+{
+  std::vector<ConvertedEntry> converted_entries;
+  converted_entries.reserve(chunk.size());
+  for(const auto & entry : chunk) {
+    switch(entry.type) {
+      case core::EntryType::Refbox2013:
+        ConvertMessage<Referee, ssl_league_msgs::msg::Referee>(entry, kRefereeTopic,
+          kRefereeTypeName, converted_entries);
+        break;
+      case core::EntryType::Vision2014:
+        ConvertMessage<SSL_WrapperPacket, ssl_league_msgs::msg::VisionWrapper>(entry,
+          kVisionTopic, kVisionTypeName, converted_entries);
+        break;
+      default:
+        break;
+    }
+  }
+  return converted_entries;
+}
+
+}  // namespace
+
+ConversionResult ConvertLog(
+  const std::filesystem::path & log_path, const std::filesystem::path & bag_path,
+  const ConversionOptions & options, WorkerPool & worker_pool, std::atomic<double> & progress)
+{
+  std::optional<core::MappedFile> log_file;
+  std::optional<core::LogReader> reader;
+  if(options.follow) {
+    // A mapping would only cover the bytes written so far
+    reader.emplace(
+      std::make_unique<core::FollowingFileSource>(log_path, options.follow_timeout));
+  } else {
+    log_file.emplace(log_path);
+    const auto compression = core::DetectCompression(log_file->GetData());
+    if(compression) {
+      reader.emplace(
+        std::make_unique<core::DecompressingSource>(log_file->GetData(), *compression));
+    } else if(core::IsPacketCapture(log_file->GetData())) {
+      reader.emplace(std::make_unique<core::PcapLogSource>(log_file->GetData()));
+    } else {
+      reader.emplace(log_file->GetData());
+    }
+  }
+
+  const auto & start_seconds = options.start_seconds;
+  const auto & end_seconds = options.end_seconds;
+  // Compressed logs and captures cannot be seeked, so they are filtered by time as they are read
+  // instead
+  const auto filter_by_time = !reader->IsSeekable() && (start_seconds || end_seconds);
+  if(reader->IsSeekable() && (start_seconds || end_seconds)) {
+    const core::LogIndex index(log_file->GetData());
+    if(index.GetEntryCount() > 0) {
+      const auto log_start_time = index.GetEntryTime(0);
+      const auto find_offset = [&](const double seconds) {
+          const auto time_ns = log_start_time + static_cast<int64_t>(seconds * 1e9);
+          return index.GetEntryOffset(index.FindEntryAtTime(time_ns));
+        };
+      if(end_seconds) {
+        reader->SetEndOffset(find_offset(*end_seconds));
+      }
+      if(start_seconds) {
+        reader->SeekToOffset(find_offset(*start_seconds));
+      }
+    }
+  }
+  const auto range_start_offset = reader->GetBytesRead();
+
+  // Declared before the writer so it is removed after the writer, which rereads it on every split
+  BagStorageConfig storage_config;
+  auto writer = std::make_unique<rosbag2_cpp::Writer>();
+  storage_config = OpenBagWriter(*writer, bag_path, options.bag_options);
+
+  ConversionResult result;
+  const auto start_time = std::chrono::steady_clock::now();
+
+  // Chunks are converted in parallel but written in log order. Limiting how many are in flight
+  // bounds memory use when the writer is slower than the workers.
+  std::deque<std::future<std::vector<ConvertedEntry>>> pending_chunks;
+  // Entries of a followed log are written as soon as they are read, instead of waiting for later
+  // entries to fill a chunk. A live log is slow enough for them to be converted one at a time.
+  const auto chunk_size = options.follow ? std::size_t{1} : kChunkSize;
+  const auto max_pending_chunks = options.follow ? std::size_t{1} : options.max_pending_chunks;
+  bool end_of_log = false;
+  std::optional<int64_t> log_start_time;
+  try {
+    while(true) {
+      while(!end_of_log && pending_chunks.size() < max_pending_chunks) {
+        std::vector<core::LogEntry> chunk;
+        chunk.reserve(chunk_size);
+        while(chunk.size() < chunk_size) {
+          auto entry = reader->GetNextMessage();
+          if(!entry) {
+            end_of_log = true;
+            break;
+          }
+          if(filter_by_time) {
+            if(!log_start_time) {
+              log_start_time = entry->received_time_ns;
+            }
+            const auto seconds = (entry->received_time_ns - *log_start_time) / 1e9;
+            if(end_seconds && seconds >= *end_seconds) {
+              end_of_log = true;
+              break;
+            }
+            if(start_seconds && seconds < *start_seconds) {
+              continue;
+            }
+          }
+          chunk.push_back(std::move(*entry));
+        }
+        if(chunk.empty()) {
+          break;
+        }
+        pending_chunks.push_back(
+          worker_pool.Submit(
+            [chunk = std::move(chunk)]() {
+              return ConvertChunk(chunk);
+            }));
+      }
+      if(pending_chunks.empty()) {
+        break;
+      }
+      const auto converted_entries = pending_chunks.front().get();
+      const auto write_start_time = std::chrono::steady_clock::now();
+      for(const auto & converted_entry : converted_entries) {
+        writer->write(converted_entry.serialized_msg, *converted_entry.topic,
+          *converted_entry.type_name, rclcpp::Time(converted_entry.received_time_ns));
+      }
+      result.write_time += std::chrono::steady_clock::now() - write_start_time;
+      pending_chunks.pop_front();
+      progress = reader->GetProgress();
+    }
+  } catch (...) {
+    // Queued chunks may point into the mapped log, so they must finish before it is unmapped
+    for(const auto & pending_chunk : pending_chunks) {
+      if(pending_chunk.valid()) {
+        pending_chunk.wait();
+      }
+    }
+    throw;
+  }
+  // Closing flushes the cache and finishes compression, so it counts as writing
+  const auto close_start_time = std::chrono::steady_clock::now();
+  writer.reset();
+  const auto end_time = std::chrono::steady_clock::now();
+  result.write_time += end_time - close_start_time;
+  result.elapsed_time = end_time - start_time;
+  progress = 1.0;
+
+  result.entry_type_counts = reader->GetEntryTypeCounts();
+  result.log_bytes = reader->GetBytesRead() - range_start_offset;
+  return result;
+}
+
+}  // namespace ssl_ros_bridge
@@ -0,0 +1,76 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef LOG2BAG__LOG_CONVERTER_HPP_
+#define LOG2BAG__LOG_CONVERTER_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <unordered_map>
+#include "core/log_reader.hpp"
+#include "bag_writer_options.hpp"
+#include "worker_pool.hpp"
+
+namespace ssl_ros_bridge
+{
+
+struct ConversionOptions
+{
+  // Seconds relative to the first entry of the log
+  std::optional<double> start_seconds;
+  std::optional<double> end_seconds;
+  BagWriterOptions bag_options;
+  // Chunks of 1024 entries allowed to wait for the writer at once
+  std::size_t max_pending_chunks{2};
+  // Keep converting as the log grows, until its writer appends the index or it stops growing
+  bool follow{false};
+  // How long a followed log may stop growing before the conversion ends. Zero waits forever.
+  std::chrono::milliseconds follow_timeout{0};
+};
+
+struct ConversionResult
+{
+  std::unordered_map<core::EntryType, uint64_t> entry_type_counts;
+  // Bytes of the log read, after decompression
+  uint64_t log_bytes{0};
+  std::chrono::duration<double> elapsed_time{0};
+  // Time spent in the bag writer, to compare storage settings
+  std::chrono::duration<double> write_time{0};
+};
+
+/**
+ * Converts the referee and vision messages of an SSL log to a bag.
+ *
+ * Entries are parsed and converted on the worker pool, which may be shared by several concurrent
+ * conversions, and written in log order.
+ *
+ * @param progress Updated with the fraction of the log converted so far
+ * @throws std::runtime_error if the log cannot be read or the bag cannot be opened
+ */
+ConversionResult ConvertLog(
+  const std::filesystem::path & log_path, const std::filesystem::path & bag_path,
+  const ConversionOptions & options, WorkerPool & worker_pool, std::atomic<double> & progress);
+
+}  // namespace ssl_ros_bridge
+
+#endif  // LOG2BAG__LOG_CONVERTER_HPP_
@@ -0,0 +1,65 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "worker_pool.hpp"
+#include <algorithm>
+
+namespace ssl_ros_bridge
+{
+
+WorkerPool::WorkerPool(const std::size_t thread_count)
+{
+  const auto clamped_thread_count = std::max<std::size_t>(thread_count, 1);
+  threads_.reserve(clamped_thread_count);
+  for(std::size_t i = 0; i < clamped_thread_count; ++i) {
+    threads_.emplace_back(&WorkerPool::RunWorker, this);
+  }
+}
+
+WorkerPool::~WorkerPool()
+{
+  {
+    std::lock_guard lock(mutex_);
+    stopping_ = true;
+  }
+  condition_.notify_all();
+  for(auto & thread : threads_) {
+    thread.join();
+  }
+}
+
+void WorkerPool::RunWorker()
+{
+  while(true) {
+    std::function<void()> task;
+    {
+      std::unique_lock lock(mutex_);
+      condition_.wait(lock, [this]() {return stopping_ || !tasks_.empty();});
+      if(tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+    task();
+  }
+}
+
+}  // namespace ssl_ros_bridge
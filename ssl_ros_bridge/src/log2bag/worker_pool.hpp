@@ -0,0 +1,82 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef LOG2BAG__WORKER_POOL_HPP_
+#define LOG2BAG__WORKER_POOL_HPP_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace ssl_ros_bridge
+{
+
+/**
+ * Fixed set of threads which run submitted tasks in submission order.
+ */
+class WorkerPool {
+public:
+  explicit WorkerPool(const std::size_t thread_count);
+
+  /**
+   * Finishes queued tasks, then joins the threads.
+   */
+  ~WorkerPool();
+
+  WorkerPool(const WorkerPool &) = delete;
+  WorkerPool & operator=(const WorkerPool &) = delete;
+
+  /**
+   * Queues a task. The returned future holds its result, or any exception it threw.
+   */
+  template<typename Function>
+  std::future<std::invoke_result_t<Function>> Submit(Function function)
+  {
+    // std::function needs a copyable target, so the move-only task is shared
+    auto task = std::make_shared<std::packaged_task<std::invoke_result_t<Function>()>>(
+      std::move(function));
+    auto future = task->get_future();
+    {
+      std::lock_guard lock(mutex_);
+      tasks_.push_back([task]() {(*task)();});
+    }
+    condition_.notify_one();
+    return future;
+  }
+
+private:
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::deque<std::function<void()>> tasks_;
+  bool stopping_{false};
+  std::vector<std::thread> threads_;
+
+  void RunWorker();
+};
+
+}  // namespace ssl_ros_bridge
+
+#endif  // LOG2BAG__WORKER_POOL_HPP_
@@ -0,0 +1,392 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <ssl_league_protobufs/ssl_gc_referee_message.pb.h>
+#include <ssl_league_protobufs/ssl_vision_wrapper.pb.h>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <format>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <variant>
+#include <rclcpp/rclcpp.hpp>
+#include <rclcpp_components/register_node_macro.hpp>
+#include "core/decompressing_source.hpp"
+#include "core/following_file_source.hpp"
+#include "core/log_index.hpp"
+#include "core/log_reader.hpp"
+#include "core/mapped_file.hpp"
+#include "core/message_conversion.hpp"
+#include "core/protobuf_logging.hpp"
+#include <ssl_league_msgs/msg/referee.hpp>
+#include <ssl_league_msgs/msg/vision_wrapper.hpp>
+#include <ssl_ros_bridge_msgs/srv/seek_log_playback.hpp>
+#include <ssl_ros_bridge_msgs/srv/set_log_playback_paused.hpp>
+
+namespace ssl_ros_bridge::log_playback
+{
+
+/**
+ * Publishes the referee and vision messages of an SSL log in real time, scaled by the rate
+ * parameter.
+ *
+ * A read-ahead thread parses and converts messages into a bounded queue, so the playback thread
+ * only has to wait for each message's time and publish it.
+ *
+ * With the follow parameter, a log which is still being written is played live instead: entries
+ * already in the file are skipped, and new ones are published as soon as they are written.
+ */
+class LogPlaybackNode : public rclcpp::Node
+{
+public:
+  explicit LogPlaybackNode(const rclcpp::NodeOptions & options)
+  : rclcpp::Node("log_playback", options),
+    referee_publisher_(create_publisher<ssl_league_msgs::msg::Referee>("~/referee_messages",
+      rclcpp::SystemDefaultsQoS())),
+    vision_publisher_(create_publisher<ssl_league_msgs::msg::VisionWrapper>("~/vision_messages",
+      rclcpp::SystemDefaultsQoS())),
+    rate_(declare_parameter<double>("rate", 1.0)),
+    as_fast_as_possible_(declare_parameter<bool>("as_fast_as_possible", false)),
+    read_ahead_size_(declare_parameter<int>("read_ahead_size", 1000)),
+    follow_(declare_parameter<bool>("follow", false)),
+    paused_(declare_parameter<bool>("start_paused", false))
+  {
+    SET_ROS_PROTOBUF_LOG_HANDLER("log_playback.protobuf");
+
+    if (rate_ <= 0.0) {
+      RCLCPP_WARN(get_logger(), "Playback rate must be positive. Using 1.0 instead of %f.", rate_);
+      rate_ = 1.0;
+    }
+    if (read_ahead_size_ < 1) {
+      RCLCPP_WARN(get_logger(), "read_ahead_size must be at least 1.");
+      read_ahead_size_ = 1;
+    }
+
+    OpenLog(declare_parameter<std::string>("log_file", ""));
+
+    const auto start_time = declare_parameter<double>("start_time", 0.0);
+    if (start_time > 0.0) {
+      std::string reason;
+      if (!RequestSeek(start_time, reason)) {
+        RCLCPP_WARN(get_logger(), "Ignoring start_time: %s", reason.c_str());
+      }
+    }
+
+    seek_service_ = create_service<ssl_ros_bridge_msgs::srv::SeekLogPlayback>(
+      "~/seek",
+      std::bind(&LogPlaybackNode::SeekCallback, this, std::placeholders::_1,
+      std::placeholders::_2));
+    pause_service_ = create_service<ssl_ros_bridge_msgs::srv::SetLogPlaybackPaused>(
+      "~/set_paused",
+      std::bind(&LogPlaybackNode::SetPausedCallback, this, std::placeholders::_1,
+      std::placeholders::_2));
+
+    read_ahead_thread_ = std::thread(&LogPlaybackNode::ReadAheadLoop, this);
+    playback_thread_ = std::thread(&LogPlaybackNode::PlaybackLoop, this);
+  }
+
+  ~LogPlaybackNode()
+  {
+    {
+      std::lock_guard lock(mutex_);
+      stopping_ = true;
+    }
+    if (following_source_ != nullptr) {
+      // The read-ahead thread may be waiting for the log to grow
+      following_source_->Stop();
+    }
+    read_ahead_condition_.notify_all();
+    playback_condition_.notify_all();
+    if (read_ahead_thread_.joinable()) {
+      read_ahead_thread_.join();
+    }
+    if (playback_thread_.joinable()) {
+      playback_thread_.join();
+    }
+  }
+
+private:
+  struct PlaybackMessage
+  {
+    int64_t log_time_ns;
+    std::variant<std::unique_ptr<ssl_league_msgs::msg::Referee>,
+      std::unique_ptr<ssl_league_msgs::msg::VisionWrapper>> msg;
+  };
+
+  rclcpp::Publisher<ssl_league_msgs::msg::Referee>::SharedPtr referee_publisher_;
+  rclcpp::Publisher<ssl_league_msgs::msg::VisionWrapper>::SharedPtr vision_publisher_;
+  rclcpp::Service<ssl_ros_bridge_msgs::srv::SeekLogPlayback>::SharedPtr seek_service_;
+  rclcpp::Service<ssl_ros_bridge_msgs::srv::SetLogPlaybackPaused>::SharedPtr pause_service_;
+  double rate_;
+  const bool as_fast_as_possible_;
+  int64_t read_ahead_size_;
+  const bool follow_;
+  std::optional<core::MappedFile> log_file_;
+  // Owned by log_reader_ when following a log
+  core::FollowingFileSource * following_source_{nullptr};
+  // Size of the log when following started. Entries within it are skipped.
+  std::size_t follow_start_offset_{0};
+  std::optional<core::LogReader> log_reader_;
+  // Only available for uncompressed logs, which can be seeked
+  std::optional<core::LogIndex> log_index_;
+  int64_t log_start_time_ns_{0};
+
+  // Guards the members below, which are shared by the service callbacks and both threads
+  std::mutex mutex_;
+  std::condition_variable read_ahead_condition_;
+  std::condition_variable playback_condition_;
+  std::deque<PlaybackMessage> queue_;
+  bool paused_;
+  std::optional<int64_t> seek_target_ns_;
+  // Set when the mapping from log time to wall time must be chosen again
+  bool timing_reset_{true};
+  bool end_of_log_{false};
+  bool end_of_log_reported_{false};
+  bool stopping_{false};
+
+  std::thread read_ahead_thread_;
+  std::thread playback_thread_;
+
+  void OpenLog(const std::string & path)
+  {
+    if (path.empty()) {
+      throw std::invalid_argument("The log_file parameter is required.");
+    }
+    if (follow_) {
+      FollowLog(path);
+      return;
+    }
+    try {
+      log_file_.emplace(path);
+      const auto compression = core::DetectCompression(log_file_->GetData());
+      if (compression) {
+        log_reader_.emplace(
+          std::make_unique<core::DecompressingSource>(log_file_->GetData(), *compression));
+      } else {
+        log_reader_.emplace(log_file_->GetData());
+        log_index_.emplace(log_file_->GetData());
+        if (log_index_->GetEntryCount() > 0) {
+          log_start_time_ns_ = log_index_->GetEntryTime(0);
+        }
+      }
+    } catch (const std::runtime_error & e) {
+      RCLCPP_ERROR(get_logger(), "Could not open log file %s: %s", path.c_str(), e.what());
+      throw;
+    }
+    const auto speed = as_fast_as_possible_ ? "full speed" : std::format("{}x speed", rate_);
+    RCLCPP_INFO(get_logger(), "Playing %s at %s.", path.c_str(), speed.c_str());
+  }
+
+  void FollowLog(const std::string & path)
+  {
+    const auto timeout = declare_parameter<double>("follow_timeout", 0.0);
+    try {
+      follow_start_offset_ = std::filesystem::file_size(path);
+      auto source = std::make_unique<core::FollowingFileSource>(
+        path, std::chrono::milliseconds(static_cast<int64_t>(timeout * 1e3)));
+      following_source_ = source.get();
+      // Waits for the file header if the writer has only just created the file
+      log_reader_.emplace(std::move(source));
+    } catch (const std::runtime_error & e) {
+      RCLCPP_ERROR(get_logger(), "Could not follow log file %s: %s", path.c_str(), e.what());
+      throw;
+    }
+    RCLCPP_INFO(get_logger(), "Following %s.", path.c_str());
+  }
+
+  /**
+   * Drops queued messages and asks the read-ahead thread to continue from the given time.
+   */
+  bool RequestSeek(const double seconds, std::string & reason)
+  {
+    if (follow_) {
+      reason = "Seeking is not supported while following a log.";
+      return false;
+    }
+    if (!log_index_) {
+      reason = "Seeking requires an uncompressed log.";
+      return false;
+    }
+    {
+      std::lock_guard lock(mutex_);
+      seek_target_ns_ = log_start_time_ns_ + static_cast<int64_t>(seconds * 1e9);
+      queue_.clear();
+      end_of_log_ = false;
+      end_of_log_reported_ = false;
+      timing_reset_ = true;
+    }
+    read_ahead_condition_.notify_all();
+    playback_condition_.notify_all();
+    return true;
+  }
+
+  void SeekCallback(
+    const ssl_ros_bridge_msgs::srv::SeekLogPlayback::Request::SharedPtr request,
+    ssl_ros_bridge_msgs::srv::SeekLogPlayback::Response::SharedPtr response)
+  {
+    response->success = RequestSeek(request->time, response->reason);
+  }
+
+  void SetPausedCallback(
+    const ssl_ros_bridge_msgs::srv::SetLogPlaybackPaused::Request::SharedPtr request,
+    ssl_ros_bridge_msgs::srv::SetLogPlaybackPaused::Response::SharedPtr response)
+  {
+    {
+      std::lock_guard lock(mutex_);
+      paused_ = request->paused;
+      timing_reset_ = true;
+    }
+    playback_condition_.notify_all();
+    response->success = true;
+  }
+
+  std::optional<PlaybackMessage> ReadNextMessage()
+  {
+    while (auto entry = log_reader_->GetNextMessage()) {
+      if (follow_ && log_reader_->GetBytesRead() <= follow_start_offset_) {
+        continue;
+      }
+      if (entry->type == core::EntryType::Refbox2013) {
+        Referee proto_msg;
+        if (!proto_msg.ParseFromArray(entry->data.data(), entry->data.size())) {
+          RCLCPP_WARN(get_logger(), "Failed to parse referee message.");
+          continue;
+        }
+        return PlaybackMessage{entry->received_time_ns,
+          std::make_unique<ssl_league_msgs::msg::Referee>(
+            message_conversion::fromProto(proto_msg))};
+      }
+      SSL_WrapperPacket proto_msg;
+      if (!proto_msg.ParseFromArray(entry->data.data(), entry->data.size())) {
+        RCLCPP_WARN(get_logger(), "Failed to parse vision message.");
+        continue;
+      }
+      return PlaybackMessage{entry->received_time_ns,
+        std::make_unique<ssl_league_msgs::msg::VisionWrapper>(
+          message_conversion::fromProto(proto_msg))};
+    }
+    return std::nullopt;
+  }
+
+  void ReadAheadLoop()
+  {
+    std::unique_lock lock(mutex_);
+    while (true) {
+      read_ahead_condition_.wait(
+        lock, [this]() {
+          return stopping_ || seek_target_ns_ ||
+          (!end_of_log_ && static_cast<int64_t>(queue_.size()) < read_ahead_size_);
+        });
+      if (stopping_) {
+        return;
+      }
+      if (seek_target_ns_) {
+        const auto entry = log_index_->FindEntryAtTime(*seek_target_ns_);
+        log_reader_->SeekToOffset(log_index_->GetEntryOffset(entry));
+        seek_target_ns_.reset();
+        continue;
+      }
+      // Parsing and conversion happen without the lock, so publishing is never blocked by them
+      lock.unlock();
+      auto message = ReadNextMessage();
+      lock.lock();
+      if (seek_target_ns_) {
+        // The message is from before the seek
+        continue;
+      }
+      if (message) {
+        queue_.push_back(std::move(*message));
+      } else {
+        end_of_log_ = true;
+      }
+      playback_condition_.notify_all();
+    }
+  }
+
+  void PlaybackLoop()
+  {
+    std::chrono::steady_clock::time_point anchor_wall_time;
+    int64_t anchor_log_time_ns = 0;
+    std::unique_lock lock(mutex_);
+    while (true) {
+      playback_condition_.wait(
+        lock, [this]() {
+          return stopping_ ||
+          (!paused_ && (!queue_.empty() || (end_of_log_ && !end_of_log_reported_)));
+        });
+      if (stopping_) {
+        return;
+      }
+      if (queue_.empty()) {
+        RCLCPP_INFO(get_logger(), "Reached the end of the log.");
+        end_of_log_reported_ = true;
+        continue;
+      }
+      const auto log_time_ns = queue_.front().log_time_ns;
+      // A followed log is paced by its writer
+      if (!as_fast_as_possible_ && !follow_) {
+        if (timing_reset_) {
+          anchor_wall_time = std::chrono::steady_clock::now();
+          anchor_log_time_ns = log_time_ns;
+          timing_reset_ = false;
+        }
+        const auto publish_time = anchor_wall_time +
+          std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::duration<double, std::nano>((log_time_ns - anchor_log_time_ns) / rate_));
+        // Pausing, seeking, and shutting down interrupt the wait
+        const auto interrupted = playback_condition_.wait_until(
+          lock, publish_time, [this]() {
+            return stopping_ || paused_ || timing_reset_;
+          });
+        if (interrupted) {
+          continue;
+        }
+      }
+      auto message = std::move(queue_.front());
+      queue_.pop_front();
+      // Refilling in batches keeps the read-ahead thread from waking up between every message
+      if (static_cast<int64_t>(queue_.size()) <= read_ahead_size_ / 2) {
+        read_ahead_condition_.notify_one();
+      }
+      lock.unlock();
+      if (auto referee_msg =
+        std::get_if<std::unique_ptr<ssl_league_msgs::msg::Referee>>(&message.msg))
+      {
+        referee_publisher_->publish(std::move(*referee_msg));
+      } else {
+        vision_publisher_->publish(
+          std::move(std::get<std::unique_ptr<ssl_league_msgs::msg::VisionWrapper>>(message.msg)));
+      }
+      lock.lock();
+    }
+  }
+};
+
+}  // namespace ssl_ros_bridge::log_playback
+
+RCLCPP_COMPONENTS_REGISTER_NODE(ssl_ros_bridge::log_playback::LogPlaybackNode)
@@ -0,0 +1,131 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <chrono>
+#include <ctime>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <rclcpp/rclcpp.hpp>
+#include <rclcpp_components/register_node_macro.hpp>
+#include "core/log_writer.hpp"
+#include "core/multicast_receiver.hpp"
+
+namespace ssl_ros_bridge::log_recorder
+{
+
+/**
+ * Records raw vision and referee multicast packets into an SSL log file.
+ *
+ * Packets are written as received, without parsing or converting them to ROS messages, and are
+ * stamped with the kernel's receive time.
+ */
+class LogRecorderNode : public rclcpp::Node
+{
+public:
+  explicit LogRecorderNode(const rclcpp::NodeOptions & options)
+  : rclcpp::Node("log_recorder", options)
+  {
+    auto log_path = declare_parameter<std::string>("log_file", "");
+    if (log_path.empty()) {
+      log_path = MakeDefaultLogFileName();
+    }
+    log_writer_ = std::make_unique<core::LogWriter>(
+      log_path,
+      [this](const std::string & message) {
+        RCLCPP_ERROR(get_logger(), "%s", message.c_str());
+      });
+    RCLCPP_INFO(get_logger(), "Recording to %s", log_path.c_str());
+
+    const auto interface_address = declare_parameter<std::string>("net_interface_address", "");
+    const auto warning_handler = [this](const std::string & message) {
+        RCLCPP_WARN(get_logger(), "%s", message.c_str());
+      };
+    vision_receiver_ = std::make_unique<core::MulticastReceiver>(
+      declare_parameter<std::string>("vision.address", "224.5.23.2"),
+      declare_parameter<int>("vision.port", 10020),
+      std::bind(&LogRecorderNode::RecordPacket, this, core::EntryType::Vision2014,
+      std::placeholders::_3, std::placeholders::_4, std::placeholders::_5),
+      interface_address, warning_handler);
+    referee_receiver_ = std::make_unique<core::MulticastReceiver>(
+      declare_parameter<std::string>("referee.address", "224.5.23.1"),
+      declare_parameter<int>("referee.port", 10003),
+      std::bind(&LogRecorderNode::RecordPacket, this, core::EntryType::Refbox2013,
+      std::placeholders::_3, std::placeholders::_4, std::placeholders::_5),
+      interface_address, warning_handler);
+
+    status_timer_ = create_wall_timer(
+      std::chrono::seconds(1),
+      std::bind(&LogRecorderNode::CheckDroppedPackets, this));
+  }
+
+  ~LogRecorderNode()
+  {
+    // Stop receiving before the writer adds the index
+    vision_receiver_.reset();
+    referee_receiver_.reset();
+    log_writer_->Close();
+    RCLCPP_INFO(
+      get_logger(), "Recorded %lu packets.",
+      static_cast<unsigned long>(log_writer_->GetEntryCount()));
+  }
+
+private:
+  std::unique_ptr<core::LogWriter> log_writer_;
+  std::unique_ptr<core::MulticastReceiver> vision_receiver_;
+  std::unique_ptr<core::MulticastReceiver> referee_receiver_;
+  rclcpp::TimerBase::SharedPtr status_timer_;
+  uint64_t reported_dropped_count_{0};
+
+  static std::string MakeDefaultLogFileName()
+  {
+    const auto now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    std::tm local_time;
+    localtime_r(&now, &local_time);
+    char file_name[64];
+    std::strftime(file_name, sizeof(file_name), "%Y-%m-%d_%H-%M-%S.log", &local_time);
+    return file_name;
+  }
+
+  void RecordPacket(
+    const core::EntryType type, const uint8_t * data, const size_t length,
+    const std::chrono::system_clock::time_point receive_time)
+  {
+    const auto receive_time_ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(receive_time.time_since_epoch());
+    log_writer_->Write(receive_time_ns.count(), type, std::span<const uint8_t>(data, length));
+  }
+
+  void CheckDroppedPackets()
+  {
+    const auto dropped_count = log_writer_->GetDroppedEntryCount();
+    if (dropped_count != reported_dropped_count_) {
+      RCLCPP_WARN(
+        get_logger(), "Dropped %lu packets because the disk is not keeping up.",
+        static_cast<unsigned long>(dropped_count - reported_dropped_count_));
+      reported_dropped_count_ = dropped_count;
+    }
+  }
+};
+
+}  // namespace ssl_ros_bridge::log_recorder
+
+RCLCPP_COMPONENTS_REGISTER_NODE(ssl_ros_bridge::log_recorder::LogRecorderNode)
@@ -0,0 +1,123 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "field_decoder.hpp"
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <ssl_league_protobufs/ssl_gc_referee_message.pb.h>
+#include <ssl_league_protobufs/ssl_vision_wrapper.pb.h>
+
+namespace ssl_ros_bridge::logstat
+{
+
+namespace
+{
+
+using google::protobuf::io::CodedInputStream;
+using google::protobuf::internal::WireFormatLite;
+
+constexpr uint32_t MakeVarintTag(const int field_number)
+{
+  return WireFormatLite::MakeTag(field_number, WireFormatLite::WIRETYPE_VARINT);
+}
+
+constexpr uint32_t MakeLengthDelimitedTag(const int field_number)
+{
+  return WireFormatLite::MakeTag(field_number, WireFormatLite::WIRETYPE_LENGTH_DELIMITED);
+}
+
+}  // namespace
+
+std::optional<DetectionFrameHeader> DecodeDetectionFrameHeader(std::span<const uint8_t> data)
+{
+  CodedInputStream input(data.data(), static_cast<int>(data.size()));
+  while(const auto tag = input.ReadTag()) {
+    if(tag != MakeLengthDelimitedTag(SSL_WrapperPacket::kDetectionFieldNumber)) {
+      if(!WireFormatLite::SkipField(&input, tag)) {
+        return std::nullopt;
+      }
+      continue;
+    }
+    uint32_t length;
+    if(!input.ReadVarint32(&length)) {
+      return std::nullopt;
+    }
+    input.PushLimit(static_cast<int>(length));
+    std::optional<uint32_t> camera_id;
+    std::optional<uint32_t> frame_number;
+    // ssl-vision writes these before the detected objects, so the objects are never read
+    while(!camera_id || !frame_number) {
+      const auto frame_tag = input.ReadTag();
+      uint32_t value;
+      if(frame_tag == 0) {
+        return std::nullopt;
+      } else if(frame_tag == MakeVarintTag(SSL_DetectionFrame::kCameraIdFieldNumber)) {
+        if(!input.ReadVarint32(&value)) {
+          return std::nullopt;
+        }
+        camera_id = value;
+      } else if(frame_tag == MakeVarintTag(SSL_DetectionFrame::kFrameNumberFieldNumber)) {
+        if(!input.ReadVarint32(&value)) {
+          return std::nullopt;
+        }
+        frame_number = value;
+      } else if(!WireFormatLite::SkipField(&input, frame_tag)) {
+        return std::nullopt;
+      }
+    }
+    return DetectionFrameHeader{*camera_id, *frame_number};
+  }
+  return std::nullopt;
+}
+
+std::optional<RefereeState> DecodeRefereeState(std::span<const uint8_t> data)
+{
+  CodedInputStream input(data.data(), static_cast<int>(data.size()));
+  std::optional<int> stage;
+  std::optional<int> command;
+  std::optional<uint32_t> command_counter;
+  while(!stage || !command || !command_counter) {
+    const auto tag = input.ReadTag();
+    uint32_t value;
+    if(tag == 0) {
+      return std::nullopt;
+    } else if(tag == MakeVarintTag(Referee::kStageFieldNumber)) {
+      if(!input.ReadVarint32(&value)) {
+        return std::nullopt;
+      }
+      stage = static_cast<int>(value);
+    } else if(tag == MakeVarintTag(Referee::kCommandFieldNumber)) {
+      if(!input.ReadVarint32(&value)) {
+        return std::nullopt;
+      }
+      command = static_cast<int>(value);
+    } else if(tag == MakeVarintTag(Referee::kCommandCounterFieldNumber)) {
+      if(!input.ReadVarint32(&value)) {
+        return std::nullopt;
+      }
+      command_counter = value;
+    } else if(!WireFormatLite::SkipField(&input, tag)) {
+      return std::nullopt;
+    }
+  }
+  return RefereeState{*stage, *command, *command_counter};
+}
+
+}  // namespace ssl_ros_bridge::logstat
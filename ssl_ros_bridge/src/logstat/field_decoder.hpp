@@ -0,0 +1,62 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef LOGSTAT__FIELD_DECODER_HPP_
+#define LOGSTAT__FIELD_DECODER_HPP_
+
+#include <cstdint>
+#include <optional>
+#include <span>
+
+namespace ssl_ros_bridge::logstat
+{
+
+struct DetectionFrameHeader
+{
+  uint32_t camera_id;
+  uint32_t frame_number;
+};
+
+struct RefereeState
+{
+  // Values of the Referee::Stage and Referee::Command enums
+  int stage;
+  int command;
+  uint32_t command_counter;
+};
+
+/**
+ * Reads the camera and frame number of an SSL_WrapperPacket without parsing the detected objects.
+ *
+ * Returns nullopt for packets without a detection frame, such as geometry-only packets, and for
+ * malformed packets.
+ */
+std::optional<DetectionFrameHeader> DecodeDetectionFrameHeader(std::span<const uint8_t> data);
+
+/**
+ * Reads the stage and command of a Referee message without parsing the team info or game events.
+ *
+ * Returns nullopt if any of the fields is missing or the message is malformed.
+ */
+std::optional<RefereeState> DecodeRefereeState(std::span<const uint8_t> data);
+
+}  // namespace ssl_ros_bridge::logstat
+
+#endif  // LOGSTAT__FIELD_DECODER_HPP_
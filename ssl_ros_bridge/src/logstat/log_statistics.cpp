@@ -0,0 +1,118 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "log_statistics.hpp"
+
+namespace ssl_ros_bridge::logstat
+{
+
+LogStatistics::LogStatistics(const std::chrono::nanoseconds gap_threshold)
+: gap_threshold_ns_(gap_threshold.count())
+{
+}
+
+void LogStatistics::AddEntry(const core::LogEntry & entry)
+{
+  // The index is written when the log is closed, so its time says nothing about the match
+  if(entry.type != core::EntryType::Index2021) {
+    if(!start_time_ns_) {
+      start_time_ns_ = entry.received_time_ns;
+    }
+    end_time_ns_ = entry.received_time_ns;
+  }
+  auto & totals = entry_type_totals_[entry.type];
+  totals.count++;
+  totals.bytes += entry.data.size();
+  switch(entry.type) {
+    case core::EntryType::Vision2014:
+      AddVisionPacket(entry);
+      break;
+    case core::EntryType::Refbox2013:
+      AddRefereeMessage(entry);
+      break;
+    default:
+      break;
+  }
+}
+
+std::chrono::duration<double> LogStatistics::GetDuration() const
+{
+  if(!start_time_ns_) {
+    return std::chrono::duration<double>(0);
+  }
+  return std::chrono::nanoseconds(end_time_ns_ - *start_time_ns_);
+}
+
+void LogStatistics::AddVisionPacket(const core::LogEntry & entry)
+{
+  const auto frame = DecodeDetectionFrameHeader(entry.data);
+  if(!frame) {
+    undecoded_count_++;
+    return;
+  }
+  CheckForGap("vision", last_vision_time_ns_, entry.received_time_ns);
+
+  auto & camera = camera_statistics_[frame->camera_id];
+  if(camera.frame_count == 0) {
+    camera.first_time_ns = entry.received_time_ns;
+  } else {
+    const auto interval_ns = entry.received_time_ns - camera.last_time_ns;
+    camera.interval_histogram_ms.AddSample(interval_ns / 1e6);
+    if(interval_ns >= gap_threshold_ns_) {
+      camera.gap_count++;
+    }
+    // Frame numbers which go backwards mean ssl-vision restarted, not dropped frames
+    if(frame->frame_number > camera.last_frame_number) {
+      camera.frames_dropped += frame->frame_number - camera.last_frame_number - 1;
+    }
+  }
+  camera.frame_count++;
+  camera.last_time_ns = entry.received_time_ns;
+  camera.last_frame_number = frame->frame_number;
+}
+
+void LogStatistics::AddRefereeMessage(const core::LogEntry & entry)
+{
+  const auto state = DecodeRefereeState(entry.data);
+  if(!state) {
+    undecoded_count_++;
+    return;
+  }
+  CheckForGap("referee", last_referee_time_ns_, entry.received_time_ns);
+
+  if(!timeline_.empty()) {
+    const auto & last_state = timeline_.back().state;
+    if(state->stage == last_state.stage && state->command_counter == last_state.command_counter) {
+      return;
+    }
+  }
+  timeline_.push_back({entry.received_time_ns, *state});
+}
+
+void LogStatistics::CheckForGap(
+  const std::string & stream, std::optional<int64_t> & last_time_ns, const int64_t time_ns)
+{
+  if(last_time_ns && time_ns - *last_time_ns >= gap_threshold_ns_) {
+    gaps_.push_back({stream, *last_time_ns, time_ns - *last_time_ns});
+  }
+  last_time_ns = time_ns;
+}
+
+}  // namespace ssl_ros_bridge::logstat
@@ -0,0 +1,148 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef LOGSTAT__LOG_STATISTICS_HPP_
+#define LOGSTAT__LOG_STATISTICS_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+#include "core/histogram.hpp"
+#include "core/log_reader.hpp"
+#include "field_decoder.hpp"
+
+namespace ssl_ros_bridge::logstat
+{
+
+/**
+ * Summarizes a log from its entry headers and a few fields of each referee and vision payload.
+ */
+class LogStatistics
+{
+public:
+  struct EntryTypeTotals
+  {
+    uint64_t count{0};
+    uint64_t bytes{0};
+  };
+
+  struct CameraStatistics
+  {
+    uint64_t frame_count{0};
+    uint64_t frames_dropped{0};
+    uint64_t gap_count{0};
+    int64_t first_time_ns{0};
+    int64_t last_time_ns{0};
+    uint32_t last_frame_number{0};
+    // Time between consecutive frames, in milliseconds
+    core::Histogram interval_histogram_ms{0.5, 200};
+  };
+
+  /**
+   * A period in which no messages of a stream were logged.
+   */
+  struct Gap
+  {
+    std::string stream;
+    int64_t start_time_ns;
+    int64_t duration_ns;
+  };
+
+  struct TimelineEvent
+  {
+    int64_t time_ns;
+    RefereeState state;
+  };
+
+  /**
+   * @param gap_threshold Shortest silence of a stream which is reported as a gap
+   */
+  explicit LogStatistics(const std::chrono::nanoseconds gap_threshold);
+
+  void AddEntry(const core::LogEntry & entry);
+
+  const std::map<core::EntryType, EntryTypeTotals> & GetEntryTypeTotals() const
+  {
+    return entry_type_totals_;
+  }
+
+  const std::map<uint32_t, CameraStatistics> & GetCameraStatistics() const
+  {
+    return camera_statistics_;
+  }
+
+  /**
+   * Returns gaps in the referee stream and in the vision stream as a whole, in log order.
+   */
+  const std::vector<Gap> & GetGaps() const
+  {
+    return gaps_;
+  }
+
+  /**
+   * Returns the first referee state and every change of stage or command after it.
+   */
+  const std::vector<TimelineEvent> & GetTimeline() const
+  {
+    return timeline_;
+  }
+
+  /**
+   * Number of vision packets without a detection frame, such as geometry packets, and referee or
+   * vision payloads which could not be decoded.
+   */
+  uint64_t GetUndecodedCount() const
+  {
+    return undecoded_count_;
+  }
+
+  std::optional<int64_t> GetStartTime() const
+  {
+    return start_time_ns_;
+  }
+
+  std::chrono::duration<double> GetDuration() const;
+
+private:
+  int64_t gap_threshold_ns_;
+  std::optional<int64_t> start_time_ns_;
+  int64_t end_time_ns_{0};
+  std::map<core::EntryType, EntryTypeTotals> entry_type_totals_;
+  std::map<uint32_t, CameraStatistics> camera_statistics_;
+  std::optional<int64_t> last_vision_time_ns_;
+  std::optional<int64_t> last_referee_time_ns_;
+  std::vector<Gap> gaps_;
+  std::vector<TimelineEvent> timeline_;
+  uint64_t undecoded_count_{0};
+
+  void AddVisionPacket(const core::LogEntry & entry);
+
+  void AddRefereeMessage(const core::LogEntry & entry);
+
+  void CheckForGap(
+    const std::string & stream, std::optional<int64_t> & last_time_ns, const int64_t time_ns);
+};
+
+}  // namespace ssl_ros_bridge::logstat
+
+#endif  // LOGSTAT__LOG_STATISTICS_HPP_
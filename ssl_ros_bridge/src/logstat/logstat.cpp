@@ -0,0 +1,253 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <getopt.h>
+#include <ssl_league_protobufs/ssl_gc_referee_message.pb.h>
+#include <chrono>
+#include <ctime>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "core/decompressing_source.hpp"
+#include "core/log_reader.hpp"
+#include "core/mapped_file.hpp"
+#include "log_statistics.hpp"
+
+using ssl_ros_bridge::core::EntryType;
+using ssl_ros_bridge::logstat::LogStatistics;
+
+void PrintUsage()
+{
+  std::cout <<
+    R"(
+Usage: logstat [OPTIONS] LOG
+Print statistics of an SSL log without converting it.
+
+LOG - An SSL log file, optionally compressed with gzip or zstd
+
+  -g, --gap SECONDS  Report streams which are silent for this long (default: 0.5)
+  -n, --no-timeline  Do not print the referee stage and command timeline
+  -h, --help         Show this message
+)";
+}
+
+/**
+ * Formats a time relative to the start of the log as H:MM:SS.s
+ */
+std::string FormatLogTime(const int64_t time_ns)
+{
+  const auto tenths = time_ns / 100'000'000;
+  std::ostringstream stream;
+  stream << tenths / 36'000 << ':' << std::setfill('0') << std::setw(2) << tenths / 600 % 60 <<
+    ':' << std::setw(2) << tenths / 10 % 60 << '.' << tenths % 10;
+  return stream.str();
+}
+
+std::string GetStageName(const int stage)
+{
+  if(!Referee_Stage_IsValid(stage)) {
+    return std::to_string(stage);
+  }
+  return Referee_Stage_Name(static_cast<Referee_Stage>(stage));
+}
+
+std::string GetCommandName(const int command)
+{
+  if(!Referee_Command_IsValid(command)) {
+    return std::to_string(command);
+  }
+  return Referee_Command_Name(static_cast<Referee_Command>(command));
+}
+
+void PrintEntryTypes(const LogStatistics & statistics)
+{
+  const std::vector<std::pair<const char *, EntryType>> entry_types = {
+    {"Referee", EntryType::Refbox2013},
+    {"Vision", EntryType::Vision2014},
+    {"Tracker", EntryType::VisionTracker2020},
+    {"Vision2010", EntryType::Vision2010},
+    {"Blank", EntryType::Blank},
+    {"Unknown", EntryType::Unknown},
+    {"Index", EntryType::Index2021}
+  };
+  std::cout << std::left << std::setw(12) << "Entry type" << std::right << std::setw(12) <<
+    "Count" << std::setw(10) << "MB" << std::setw(10) << "Rate Hz" << '\n';
+  const auto duration = statistics.GetDuration().count();
+  for(const auto & [name, type] : entry_types) {
+    const auto totals = statistics.GetEntryTypeTotals().find(type);
+    if(totals == statistics.GetEntryTypeTotals().end()) {
+      continue;
+    }
+    std::cout << std::left << std::setw(12) << name << std::right << std::setw(12) <<
+      totals->second.count << std::setw(10) << totals->second.bytes / 1e6 << std::setw(10) <<
+      (duration > 0 ? totals->second.count / duration : 0.0) << '\n';
+  }
+  if(statistics.GetUndecodedCount() > 0) {
+    std::cout << statistics.GetUndecodedCount() <<
+      " referee or vision entries had no detection frame or could not be decoded.\n";
+  }
+}
+
+void PrintCameras(const LogStatistics & statistics)
+{
+  std::cout << "\nCamera    Frames   Rate Hz   Dropped   p50 ms   p99 ms   Max ms    Gaps\n";
+  for(const auto & [camera_id, camera] : statistics.GetCameraStatistics()) {
+    const auto duration = (camera.last_time_ns - camera.first_time_ns) / 1e9;
+    const auto & intervals = camera.interval_histogram_ms;
+    std::cout << std::setw(6) << camera_id << std::setw(10) << camera.frame_count <<
+      std::setw(10) << (duration > 0 ? (camera.frame_count - 1) / duration : 0.0) <<
+      std::setw(10) << camera.frames_dropped << std::setw(9) << intervals.GetPercentile(0.5) <<
+      std::setw(9) << intervals.GetPercentile(0.99) << std::setw(9) << intervals.GetMax() <<
+      std::setw(8) << camera.gap_count << '\n';
+  }
+}
+
+void PrintGaps(const LogStatistics & statistics, const double gap_seconds)
+{
+  const auto start_time_ns = statistics.GetStartTime().value_or(0);
+  std::cout << "\nGaps of " << gap_seconds << " s or more:";
+  if(statistics.GetGaps().empty()) {
+    std::cout << " none\n";
+    return;
+  }
+  std::cout << '\n';
+  for(const auto & gap : statistics.GetGaps()) {
+    std::cout << "  " << FormatLogTime(gap.start_time_ns - start_time_ns) << "  " <<
+      std::left << std::setw(8) << gap.stream << std::right << gap.duration_ns / 1e9 << " s\n";
+  }
+}
+
+void PrintTimeline(const LogStatistics & statistics)
+{
+  const auto start_time_ns = statistics.GetStartTime().value_or(0);
+  std::cout << "\nReferee timeline:\n";
+  std::optional<int> last_stage;
+  for(const auto & event : statistics.GetTimeline()) {
+    std::cout << "  " << FormatLogTime(event.time_ns - start_time_ns) << "  ";
+    // Only stage changes are labelled, so the commands of each stage are easy to follow
+    std::cout << std::left << std::setw(28) <<
+      (event.state.stage != last_stage ? GetStageName(event.state.stage) : "") << std::right <<
+      GetCommandName(event.state.command) << '\n';
+    last_stage = event.state.stage;
+  }
+}
+
+int main(int argc, char ** argv)
+{
+  double gap_seconds = 0.5;
+  bool print_timeline = true;
+
+  const option long_options[] = {
+    {"gap", required_argument, nullptr, 'g'},
+    {"no-timeline", no_argument, nullptr, 'n'},
+    {"help", no_argument, nullptr, 'h'},
+    {nullptr, 0, nullptr, 0}
+  };
+  int opt;
+  while((opt = getopt_long(argc, argv, "g:nh", long_options, nullptr)) != -1) {
+    switch(opt) {
+      case 'g':
+        try {
+          gap_seconds = std::stod(optarg);
+        } catch (const std::logic_error &) {
+          gap_seconds = 0.0;
+        }
+        if(gap_seconds <= 0.0) {
+          std::cerr << "Invalid gap: " << optarg << '\n';
+          return 1;
+        }
+        break;
+      case 'n':
+        print_timeline = false;
+        break;
+      case 'h':
+        PrintUsage();
+        return 0;
+      default:
+        PrintUsage();
+        return 1;
+    }
+  }
+
+  if(argc - optind != 1) {
+    PrintUsage();
+    return 1;
+  }
+  const std::filesystem::path log_path = argv[optind];
+
+  LogStatistics statistics(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::duration<double>(gap_seconds)));
+  const auto start_time = std::chrono::steady_clock::now();
+  std::size_t bytes_read = 0;
+  try {
+    const ssl_ros_bridge::core::MappedFile log_file(log_path);
+    const auto compression = ssl_ros_bridge::core::DetectCompression(log_file.GetData());
+    std::optional<ssl_ros_bridge::core::LogReader> reader;
+    if(compression) {
+      reader.emplace(
+        std::make_unique<ssl_ros_bridge::core::DecompressingSource>(
+          log_file.GetData(), *compression));
+    } else {
+      reader.emplace(log_file.GetData());
+    }
+    while(const auto entry = reader->GetNextEntry()) {
+      statistics.AddEntry(*entry);
+    }
+    bytes_read = reader->GetBytesRead();
+  } catch (const std::runtime_error & e) {
+    std::cerr << "Could not read " << log_path << ": " << e.what() << '\n';
+    return 1;
+  }
+  const std::chrono::duration<double> elapsed_time = std::chrono::steady_clock::now() - start_time;
+
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << "Log:      " << log_path.string() << '\n';
+  if(const auto log_start_time = statistics.GetStartTime()) {
+    const auto start_seconds = static_cast<std::time_t>(*log_start_time / 1'000'000'000);
+    std::tm start_tm;
+    gmtime_r(&start_seconds, &start_tm);
+    std::cout << "Start:    " << std::put_time(&start_tm, "%Y-%m-%d %H:%M:%S UTC") << '\n';
+  }
+  std::cout << "Duration: " <<
+    FormatLogTime(std::chrono::duration_cast<std::chrono::nanoseconds>(
+      statistics.GetDuration()).count()) << "\n\n";
+
+  PrintEntryTypes(statistics);
+  PrintCameras(statistics);
+  PrintGaps(statistics, gap_seconds);
+  if(print_timeline) {
+    PrintTimeline(statistics);
+  }
+
+  const auto megabytes = bytes_read / 1e6;
+  std::cout << "\nScanned " << megabytes << " MB in " << std::setprecision(2) <<
+    elapsed_time.count() << " s (" << std::setprecision(1) <<
+    megabytes / elapsed_time.count() << " MB/s).\n";
+
+  return 0;
+}
@@ -0,0 +1,100 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <getopt.h>
+
+#include <chrono>
+#include <csignal>
+#include <iostream>
+#include <string>
+
+#include <boost/asio.hpp>
+
+#include "mock_gc_server.hpp"
+
+void PrintUsage()
+{
+  std::cout <<
+    R"(
+Usage: mock_gc [OPTIONS]
+Run a mock game controller team server for testing team clients.
+
+  -p, --port PORT        Port to listen on (default: 10008)
+  -d, --delay MS         Delay before each reply, in milliseconds (default: 0)
+  -f, --fragment BYTES   Split each reply into writes of at most BYTES (default: 0, disabled)
+  -e, --error-rate RATE  Fraction of requests to reject, from 0 to 1 (default: 0)
+  -h, --help             Show this message
+)";
+}
+
+int main(int argc, char ** argv)
+{
+  ssl_ros_bridge::mock_gc::MockGcServer::Options options;
+
+  const option long_options[] = {
+    {"port", required_argument, nullptr, 'p'},
+    {"delay", required_argument, nullptr, 'd'},
+    {"fragment", required_argument, nullptr, 'f'},
+    {"error-rate", required_argument, nullptr, 'e'},
+    {"help", no_argument, nullptr, 'h'},
+    {nullptr, 0, nullptr, 0}
+  };
+  int opt;
+  try {
+    while ((opt = getopt_long(argc, argv, "p:d:f:e:h", long_options, nullptr)) != -1) {
+      switch (opt) {
+        case 'p':
+          options.port = std::stoi(optarg);
+          break;
+        case 'd':
+          options.reply_delay =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::duration<double, std::milli>(std::stod(optarg)));
+          break;
+        case 'f':
+          options.fragment_size = std::stoul(optarg);
+          break;
+        case 'e':
+          options.error_rate = std::stod(optarg);
+          break;
+        case 'h':
+          PrintUsage();
+          return 0;
+        default:
+          PrintUsage();
+          return 1;
+      }
+    }
+  } catch (const std::logic_error &) {
+    std::cerr << "Invalid option value.\n";
+    PrintUsage();
+    return 1;
+  }
+
+  ssl_ros_bridge::mock_gc::MockGcServer server(options);
+  std::cout << "Mock game controller listening on port " << server.GetPort() << '\n';
+
+  boost::asio::io_service io_service;
+  boost::asio::signal_set signals(io_service, SIGINT, SIGTERM);
+  signals.async_wait([](const boost::system::error_code &, int) {});
+  io_service.run();
+
+  return 0;
+}
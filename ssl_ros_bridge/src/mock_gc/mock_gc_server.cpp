@@ -0,0 +1,224 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "mock_gc_server.hpp"
+
+#include <ssl_league_protobufs/ssl_gc_rcon_team.pb.h>
+#include <google/protobuf/util/delimited_message_util.h>
+
+#include <algorithm>
+#include <deque>
+#include <iostream>
+#include <sstream>
+#include <utility>
+
+#include "team_client/delimited_message_decoder.hpp"
+
+namespace ssl_ros_bridge::mock_gc
+{
+
+class MockGcServer::Session : public std::enable_shared_from_this<Session>
+{
+public:
+  Session(MockGcServer & server, boost::asio::ip::tcp::socket socket)
+  : server_(server),
+    socket_(std::move(socket))
+  {
+    // Keep fragments as separate segments instead of letting the kernel coalesce them
+    socket_.set_option(boost::asio::ip::tcp::no_delay(true));
+  }
+
+  void Start()
+  {
+    // Real game controllers greet new clients with the token for their first signed message
+    ControllerToTeam greeting;
+    greeting.mutable_controller_reply()->set_status_code(ControllerReply::OK);
+    greeting.mutable_controller_reply()->set_next_token(server_.NextToken());
+    SendReply(greeting);
+    StartRead();
+  }
+
+private:
+  MockGcServer & server_;
+  boost::asio::ip::tcp::socket socket_;
+  game_controller_bridge::DelimitedMessageDecoder decoder_;
+  bool registered_{false};
+  std::deque<std::string> write_queue_;
+
+  void StartRead()
+  {
+    const auto read_buffer = decoder_.PrepareWrite(1024);
+    socket_.async_read_some(
+      boost::asio::buffer(read_buffer.data(), read_buffer.size()),
+      [self = shared_from_this()](const boost::system::error_code & error, std::size_t bytes) {
+        self->HandleRead(error, bytes);
+      });
+  }
+
+  void HandleRead(const boost::system::error_code & error, const std::size_t bytes_received)
+  {
+    if (error) {
+      // Dropping the last reference to the session closes the socket
+      return;
+    }
+    decoder_.CommitWrite(bytes_received);
+    while (true) {
+      ControllerToTeam reply;
+      auto & controller_reply = *reply.mutable_controller_reply();
+      game_controller_bridge::DelimitedMessageDecoder::Status status;
+      if (!registered_) {
+        TeamRegistration registration;
+        status = decoder_.Next(registration);
+        if (status == game_controller_bridge::DelimitedMessageDecoder::Status::Complete) {
+          registered_ = !registration.team_name().empty();
+          if (registered_) {
+            controller_reply.set_status_code(ControllerReply::OK);
+          } else {
+            controller_reply.set_status_code(ControllerReply::REJECTED);
+            controller_reply.set_reason("Team name is missing.");
+          }
+        }
+      } else {
+        TeamToController request;
+        status = decoder_.Next(request);
+        if (status == game_controller_bridge::DelimitedMessageDecoder::Status::Complete) {
+          if (server_.ShouldReject()) {
+            controller_reply.set_status_code(ControllerReply::REJECTED);
+            controller_reply.set_reason("Mock error.");
+          } else {
+            controller_reply.set_status_code(ControllerReply::OK);
+          }
+        }
+      }
+      if (status == game_controller_bridge::DelimitedMessageDecoder::Status::Incomplete) {
+        break;
+      }
+      if (status == game_controller_bridge::DelimitedMessageDecoder::Status::Error) {
+        std::cerr << "Mock GC could not parse client message. Closing connection.\n";
+        return;
+      }
+      controller_reply.set_next_token(server_.NextToken());
+      SendReply(reply);
+    }
+    StartRead();
+  }
+
+  void SendReply(const ControllerToTeam & reply)
+  {
+    std::ostringstream stream;
+    google::protobuf::util::SerializeDelimitedToOstream(reply, &stream);
+    auto data = stream.str();
+    if (server_.options_.reply_delay.count() == 0) {
+      QueueWrite(std::move(data));
+      return;
+    }
+    // Every reply waits the same delay, so timers expire in the order the requests arrived
+    auto timer = std::make_shared<boost::asio::steady_timer>(
+      server_.io_service_,
+      server_.options_.reply_delay);
+    timer->async_wait(
+      [self = shared_from_this(), timer, data = std::move(data)](
+        const boost::system::error_code & error) mutable {
+        if (!error) {
+          self->QueueWrite(std::move(data));
+        }
+      });
+  }
+
+  void QueueWrite(std::string data)
+  {
+    const auto fragment_size =
+      server_.options_.fragment_size == 0 ? data.size() : server_.options_.fragment_size;
+    const auto write_in_progress = !write_queue_.empty();
+    for (std::size_t offset = 0; offset < data.size(); offset += fragment_size) {
+      write_queue_.push_back(data.substr(offset, fragment_size));
+    }
+    if (!write_in_progress) {
+      StartWrite();
+    }
+  }
+
+  void StartWrite()
+  {
+    boost::asio::async_write(
+      socket_, boost::asio::buffer(write_queue_.front()),
+      [self = shared_from_this()](const boost::system::error_code & error, std::size_t) {
+        if (error) {
+          return;
+        }
+        self->write_queue_.pop_front();
+        if (!self->write_queue_.empty()) {
+          self->StartWrite();
+        }
+      });
+  }
+};
+
+MockGcServer::MockGcServer(const Options & options)
+: options_(options),
+  random_engine_(std::random_device{}()),
+  error_distribution_(std::clamp(options.error_rate, 0.0, 1.0)),
+  acceptor_(io_service_,
+    boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), options.port))
+{
+  StartAccept();
+  io_service_thread_ = std::thread(
+    [this]() {
+      io_service_.run();
+    });
+}
+
+MockGcServer::~MockGcServer()
+{
+  io_service_.stop();
+  if (io_service_thread_.joinable()) {
+    io_service_thread_.join();
+  }
+}
+
+uint16_t MockGcServer::GetPort() const
+{
+  return acceptor_.local_endpoint().port();
+}
+
+void MockGcServer::StartAccept()
+{
+  acceptor_.async_accept(
+    [this](const boost::system::error_code & error, boost::asio::ip::tcp::socket socket) {
+      if (error) {
+        std::cerr << "Mock GC accept failed: " << error.message() << '\n';
+      } else {
+        std::make_shared<Session>(*this, std::move(socket))->Start();
+      }
+      StartAccept();
+    });
+}
+
+std::string MockGcServer::NextToken()
+{
+  return "mock-token-" + std::to_string(token_count_++);
+}
+
+bool MockGcServer::ShouldReject()
+{
+  return error_distribution_(random_engine_);
+}
+
+}  // namespace ssl_ros_bridge::mock_gc
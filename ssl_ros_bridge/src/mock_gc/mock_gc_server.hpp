@@ -0,0 +1,87 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef MOCK_GC__MOCK_GC_SERVER_HPP_
+#define MOCK_GC__MOCK_GC_SERVER_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+
+#include <boost/asio.hpp>
+
+namespace ssl_ros_bridge::mock_gc
+{
+
+/**
+ * Minimal stand-in for the game controller's team remote control server.
+ *
+ * Performs the token greeting and team registration handshake, then answers every
+ * TeamToController request with a ControllerReply. Replies can be delayed, split across several
+ * TCP writes, or randomly rejected to exercise clients. Runs on its own IO thread.
+ */
+class MockGcServer
+{
+public:
+  struct Options
+  {
+    /// Port to listen on. Zero picks a free port.
+    uint16_t port{10008};
+    /// Delay before each reply is sent
+    std::chrono::microseconds reply_delay{0};
+    /// Maximum bytes per write when sending a reply. Zero sends each reply in one write.
+    std::size_t fragment_size{0};
+    /// Fraction of requests answered with a REJECTED status
+    double error_rate{0.0};
+  };
+
+  explicit MockGcServer(const Options & options);
+
+  ~MockGcServer();
+
+  /**
+   * Returns the port the server is listening on.
+   */
+  uint16_t GetPort() const;
+
+private:
+  class Session;
+
+  Options options_;
+  std::mt19937 random_engine_;
+  std::bernoulli_distribution error_distribution_;
+  uint64_t token_count_{0};
+  boost::asio::io_service io_service_;
+  boost::asio::ip::tcp::acceptor acceptor_;
+  std::thread io_service_thread_;
+
+  void StartAccept();
+
+  std::string NextToken();
+
+  bool ShouldReject();
+};
+
+}  // namespace ssl_ros_bridge::mock_gc
+
+#endif  // MOCK_GC__MOCK_GC_SERVER_HPP_
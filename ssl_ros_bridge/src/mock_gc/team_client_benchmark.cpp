@@ -0,0 +1,289 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <getopt.h>
+
+#include <chrono>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+
+#include <rclcpp/rclcpp.hpp>
+
+#include "core/histogram.hpp"
+#include "team_client/team_client.hpp"
+#include "mock_gc_server.hpp"
+
+using ssl_ros_bridge::core::Histogram;
+using ssl_ros_bridge::game_controller_bridge::TeamClient;
+using ssl_ros_bridge::mock_gc::MockGcServer;
+
+namespace
+{
+// 10 us buckets up to 100 ms
+constexpr double kBucketWidthMs = 0.01;
+constexpr std::size_t kBucketCount = 10000;
+constexpr std::chrono::seconds kOperationTimeout{5};
+
+struct OperationStats
+{
+  Histogram latency_ms{kBucketWidthMs, kBucketCount};
+  uint64_t failure_count{0};
+};
+}  // namespace
+
+void PrintUsage()
+{
+  std::cout <<
+    R"(
+Usage: team_client_benchmark [OPTIONS]
+Measure team client request latency against a mock game controller over loopback.
+
+  -n, --iterations N     Requests to time for each operation (default: 1000)
+  -d, --delay MS         Mock server reply delay, in milliseconds (default: 0)
+  -f, --fragment BYTES   Mock server reply fragment size (default: 0, disabled)
+  -e, --error-rate RATE  Fraction of requests the mock server rejects (default: 0)
+  -a, --address ADDRESS  Benchmark an existing server instead of starting the mock server
+  -p, --port PORT        Port of the existing server (default: 10008)
+  -h, --help             Show this message
+)";
+}
+
+/**
+ * Runs one operation at a time and records how long each takes to complete.
+ *
+ * @param operation Starts the operation and calls its argument with the outcome when done
+ */
+template<typename Operation>
+bool MeasureSequential(const int iterations, Operation operation, OperationStats & stats)
+{
+  for (int i = 0; i < iterations; ++i) {
+    auto promise = std::make_shared<std::promise<bool>>();
+    auto future = promise->get_future();
+    const auto start_time = std::chrono::steady_clock::now();
+    operation(i, [promise](bool success) {promise->set_value(success);});
+    if (future.wait_for(kOperationTimeout) != std::future_status::ready) {
+      std::cerr << "Operation did not complete. Is the server running?\n";
+      return false;
+    }
+    const std::chrono::duration<double, std::milli> latency =
+      std::chrono::steady_clock::now() - start_time;
+    stats.latency_ms.AddSample(latency.count());
+    if (!future.get()) {
+      stats.failure_count++;
+    }
+  }
+  return true;
+}
+
+/**
+ * Sends every request at once and records the latency of each reply.
+ *
+ * @return Total time for all replies to arrive, or nullopt if they did not all arrive
+ */
+std::optional<std::chrono::duration<double>> MeasurePipelined(
+  TeamClient & client, const int iterations,
+  OperationStats & stats)
+{
+  // Replies may still arrive after a timeout, so their callbacks share ownership of this state
+  struct PipelineState
+  {
+    std::mutex mutex;
+    OperationStats stats;
+    int remaining;
+    std::promise<void> done_promise;
+  };
+  auto state = std::make_shared<PipelineState>();
+  state->remaining = iterations;
+  auto done_future = state->done_promise.get_future();
+  const auto start_time = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; ++i) {
+    const auto send_time = std::chrono::steady_clock::now();
+    client.SetDesiredKeeper(
+      i % 16, [state, send_time](const TeamClient::Result & result) {
+        const std::chrono::duration<double, std::milli> latency =
+        std::chrono::steady_clock::now() - send_time;
+        std::lock_guard lock(state->mutex);
+        state->stats.latency_ms.AddSample(latency.count());
+        if (!result.accepted) {
+          state->stats.failure_count++;
+        }
+        if (--state->remaining == 0) {
+          state->done_promise.set_value();
+        }
+      });
+  }
+  if (done_future.wait_for(kOperationTimeout) != std::future_status::ready) {
+    std::cerr << "Pipelined requests did not complete.\n";
+    return std::nullopt;
+  }
+  const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start_time;
+  std::lock_guard lock(state->mutex);
+  stats.latency_ms.Merge(state->stats.latency_ms);
+  stats.failure_count += state->stats.failure_count;
+  return duration;
+}
+
+void PrintStatsRow(const std::string & name, const OperationStats & stats)
+{
+  const auto & histogram = stats.latency_ms;
+  std::cout << std::left << std::setw(20) << name << std::right <<
+    std::setw(8) << histogram.GetSampleCount() <<
+    std::setw(8) << stats.failure_count << std::fixed << std::setprecision(3) <<
+    std::setw(10) << histogram.GetMean() <<
+    std::setw(10) << histogram.GetPercentile(0.5) <<
+    std::setw(10) << histogram.GetPercentile(0.9) <<
+    std::setw(10) << histogram.GetPercentile(0.99) <<
+    std::setw(10) << histogram.GetMax() << '\n';
+}
+
+int main(int argc, char ** argv)
+{
+  int iterations = 1000;
+  MockGcServer::Options server_options;
+  server_options.port = 0;
+  std::string address = "127.0.0.1";
+  uint16_t port = 10008;
+  bool use_mock_server = true;
+
+  const option long_options[] = {
+    {"iterations", required_argument, nullptr, 'n'},
+    {"delay", required_argument, nullptr, 'd'},
+    {"fragment", required_argument, nullptr, 'f'},
+    {"error-rate", required_argument, nullptr, 'e'},
+    {"address", required_argument, nullptr, 'a'},
+    {"port", required_argument, nullptr, 'p'},
+    {"help", no_argument, nullptr, 'h'},
+    {nullptr, 0, nullptr, 0}
+  };
+  int opt;
+  try {
+    while ((opt = getopt_long(argc, argv, "n:d:f:e:a:p:h", long_options, nullptr)) != -1) {
+      switch (opt) {
+        case 'n':
+          iterations = std::stoi(optarg);
+          break;
+        case 'd':
+          server_options.reply_delay =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::duration<double, std::milli>(std::stod(optarg)));
+          break;
+        case 'f':
+          server_options.fragment_size = std::stoul(optarg);
+          break;
+        case 'e':
+          server_options.error_rate = std::stod(optarg);
+          break;
+        case 'a':
+          address = optarg;
+          use_mock_server = false;
+          break;
+        case 'p':
+          port = std::stoi(optarg);
+          break;
+        case 'h':
+          PrintUsage();
+          return 0;
+        default:
+          PrintUsage();
+          return 1;
+      }
+    }
+  } catch (const std::logic_error &) {
+    std::cerr << "Invalid option value.\n";
+    PrintUsage();
+    return 1;
+  }
+  if (iterations <= 0) {
+    std::cerr << "Iterations must be positive.\n";
+    return 1;
+  }
+
+  std::unique_ptr<MockGcServer> server;
+  if (use_mock_server) {
+    server = std::make_unique<MockGcServer>(server_options);
+    port = server->GetPort();
+  }
+
+  TeamClient::ConnectionParameters connection_parameters;
+  connection_parameters.address = boost::asio::ip::address::from_string(address);
+  connection_parameters.port = port;
+  connection_parameters.team_name = "Benchmark Team";
+  connection_parameters.team_color = TeamClient::TeamColor::Auto;
+
+  TeamClient client(rclcpp::get_logger("team_client_benchmark"));
+
+  OperationStats connect_stats;
+  const auto connect = [&](int, auto done) {
+      client.Connect(connection_parameters, done);
+    };
+  if (!MeasureSequential(iterations, connect, connect_stats)) {
+    return 1;
+  }
+  if (!client.IsConnected()) {
+    std::cerr << "Team client is not connected after the connect benchmark.\n";
+    return 1;
+  }
+
+  OperationStats ping_stats;
+  const auto ping = [&](int, auto done) {
+      client.Ping(
+        [done](const TeamClient::PingResult & result) {
+          done(result.request_result.accepted);
+        });
+    };
+  if (!MeasureSequential(iterations, ping, ping_stats)) {
+    return 1;
+  }
+
+  OperationStats keeper_stats;
+  const auto set_keeper = [&](int i, auto done) {
+      client.SetDesiredKeeper(
+        i % 16, [done](const TeamClient::Result & result) {
+          done(result.accepted);
+        });
+    };
+  if (!MeasureSequential(iterations, set_keeper, keeper_stats)) {
+    return 1;
+  }
+
+  OperationStats pipelined_stats;
+  const auto pipelined_duration = MeasurePipelined(client, iterations, pipelined_stats);
+  if (!pipelined_duration) {
+    return 1;
+  }
+
+  std::cout << '\n' << std::left << std::setw(20) << "Operation" << std::right <<
+    std::setw(8) << "Count" << std::setw(8) << "Failed" << std::setw(10) << "Mean" <<
+    std::setw(10) << "p50" << std::setw(10) << "p90" << std::setw(10) << "p99" <<
+    std::setw(10) << "Max" << '\n';
+  PrintStatsRow("Connect", connect_stats);
+  PrintStatsRow("Ping", ping_stats);
+  PrintStatsRow("SetDesiredKeeper", keeper_stats);
+  PrintStatsRow("Pipelined keeper", pipelined_stats);
+  std::cout << "\nLatencies in milliseconds. Pipelined throughput: " << std::setprecision(0) <<
+    (iterations / pipelined_duration->count()) << " requests/s\n";
+
+  return 0;
+}
@@ -0,0 +1,131 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <getopt.h>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include "core/log_reader.hpp"
+#include "core/log_writer.hpp"
+#include "core/mapped_file.hpp"
+#include "core/pcap_log_source.hpp"
+#include "log2bag/command_line.hpp"
+
+using ssl_ros_bridge::core::EntryType;
+
+void PrintUsage()
+{
+  std::cout <<
+    R"(
+Usage: pcap2log [OPTIONS] CAPTURE
+Extract the vision and referee multicast traffic of a pcap or pcapng capture into an SSL log.
+
+CAPTURE - A capture taken with tcpdump, Wireshark, or similar tools
+
+  -o, --output FILE  Log file to write (default: the capture name with a .log extension)
+  -h, --help         Show this message
+)";
+}
+
+int main(int argc, char ** argv)
+{
+  std::optional<std::filesystem::path> output_path;
+
+  const option long_options[] = {
+    {"output", required_argument, nullptr, 'o'},
+    {"help", no_argument, nullptr, 'h'},
+    {nullptr, 0, nullptr, 0}
+  };
+  int opt;
+  while((opt = getopt_long(argc, argv, "o:h", long_options, nullptr)) != -1) {
+    switch(opt) {
+      case 'o':
+        output_path = optarg;
+        break;
+      case 'h':
+        PrintUsage();
+        return 0;
+      default:
+        PrintUsage();
+        return 1;
+    }
+  }
+
+  if(argc - optind != 1) {
+    PrintUsage();
+    return 1;
+  }
+  const std::filesystem::path capture_path = argv[optind];
+  if(!output_path) {
+    output_path = capture_path.filename().replace_extension(".log");
+  }
+
+  const auto start_time = std::chrono::steady_clock::now();
+  uint64_t incomplete_datagram_count = 0;
+  uint64_t entry_count = 0;
+  try {
+    const ssl_ros_bridge::core::MappedFile capture_file(capture_path);
+    auto source = std::make_unique<ssl_ros_bridge::core::PcapLogSource>(capture_file.GetData());
+    const auto & capture_source = *source;
+    ssl_ros_bridge::core::LogReader reader(std::move(source));
+    // The capture is read far faster than the disk is written, so nothing may be dropped
+    ssl_ros_bridge::core::LogWriter writer(
+      *output_path, nullptr, 64 << 20,
+      ssl_ros_bridge::core::LogWriter::FullBufferPolicy::Wait);
+
+    auto last_render_time = std::chrono::steady_clock::now();
+    ssl_ros_bridge::RenderProgressBar(0.0);
+    while(const auto entry = reader.GetNextEntry()) {
+      if(!writer.Write(entry->received_time_ns, entry->type, entry->data)) {
+        throw std::runtime_error("Could not write " + output_path->string() + ".");
+      }
+      const auto now = std::chrono::steady_clock::now();
+      if(now - last_render_time > std::chrono::milliseconds(100)) {
+        ssl_ros_bridge::RenderProgressBar(reader.GetProgress());
+        last_render_time = now;
+      }
+    }
+    writer.Close();
+    ssl_ros_bridge::RenderProgressBar(1.0);
+    std::cout << "\n\n";
+
+    incomplete_datagram_count = capture_source.GetIncompleteDatagramCount();
+    entry_count = writer.GetEntryCount();
+    const auto & entry_type_counts = reader.GetEntryTypeCounts();
+    std::cout << "Referee messages: " << entry_type_counts.at(EntryType::Refbox2013) << '\n';
+    std::cout << "Vision messages:  " << entry_type_counts.at(EntryType::Vision2014) << '\n';
+  } catch (const std::runtime_error & e) {
+    std::cerr << "\nCould not convert " << capture_path << ": " << e.what() << '\n';
+    return 1;
+  }
+  const std::chrono::duration<double> elapsed_time = std::chrono::steady_clock::now() - start_time;
+
+  if(incomplete_datagram_count > 0) {
+    std::cout << incomplete_datagram_count <<
+      " fragmented datagrams were missing fragments and were skipped.\n";
+  }
+  std::cout << "Wrote " << entry_count << " entries to " << output_path->string() << " in " <<
+    elapsed_time.count() << " s.\n";
+  return 0;
+}
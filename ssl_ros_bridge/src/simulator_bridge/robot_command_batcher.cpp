@@ -0,0 +1,61 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "robot_command_batcher.hpp"
+
+#include <utility>
+
+namespace ssl_ros_bridge::simulator_bridge
+{
+
+void RobotCommandBatcher::Add(RobotCommand command)
+{
+  std::lock_guard lock(mutex_);
+  metrics_.received_commands++;
+  const auto [iter, inserted] = pending_commands_.try_emplace(command.id());
+  if(!inserted) {
+    metrics_.superseded_commands++;
+  }
+  iter->second = std::move(command);
+}
+
+bool RobotCommandBatcher::TakeBatch(RobotControl & control)
+{
+  control.clear_robot_commands();
+  std::lock_guard lock(mutex_);
+  if(pending_commands_.empty()) {
+    return false;
+  }
+  control.mutable_robot_commands()->Reserve(pending_commands_.size());
+  for(auto & [id, command] : pending_commands_) {
+    *control.add_robot_commands() = std::move(command);
+  }
+  pending_commands_.clear();
+  metrics_.sent_batches++;
+  return true;
+}
+
+RobotCommandBatcher::Metrics RobotCommandBatcher::GetMetrics() const
+{
+  std::lock_guard lock(mutex_);
+  return metrics_;
+}
+
+}  // namespace ssl_ros_bridge::simulator_bridge
@@ -0,0 +1,69 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef SIMULATOR_BRIDGE__ROBOT_COMMAND_BATCHER_HPP_
+#define SIMULATOR_BRIDGE__ROBOT_COMMAND_BATCHER_HPP_
+
+#include <ssl_league_protobufs/ssl_simulation_robot_control.pb.h>
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+
+namespace ssl_ros_bridge::simulator_bridge
+{
+
+/**
+ * Collects robot commands between control ticks so one team's commands go out in a single
+ * RobotControl packet.
+ *
+ * Only the latest command for each robot is kept. All methods are thread safe.
+ */
+class RobotCommandBatcher
+{
+public:
+  struct Metrics
+  {
+    uint64_t received_commands{0};
+    /// Commands dropped because a newer one for the same robot arrived in the same tick
+    uint64_t superseded_commands{0};
+    uint64_t sent_batches{0};
+  };
+
+  void Add(RobotCommand command);
+
+  /**
+   * Moves the pending commands into control, ordered by robot id.
+   *
+   * @return false if no commands were pending, in which case nothing needs to be sent
+   */
+  bool TakeBatch(RobotControl & control);
+
+  Metrics GetMetrics() const;
+
+private:
+  mutable std::mutex mutex_;
+  std::map<uint32_t, RobotCommand> pending_commands_;
+  Metrics metrics_;
+};
+
+}  // namespace ssl_ros_bridge::simulator_bridge
+
+#endif  // SIMULATOR_BRIDGE__ROBOT_COMMAND_BATCHER_HPP_
@@ -0,0 +1,205 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <ssl_league_protobufs/ssl_simulation_robot_control.pb.h>
+#include <ssl_league_protobufs/ssl_simulation_robot_feedback.pb.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <rclcpp/rclcpp.hpp>
+#include <rclcpp_components/register_node_macro.hpp>
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
+#include <ssl_league_msgs/msg/robot_command.hpp>
+#include <ssl_league_msgs/msg/robot_control.hpp>
+#include <ssl_league_msgs/msg/robot_control_response.hpp>
+
+#include "core/message_conversion.hpp"
+#include "core/multicast_receiver.hpp"
+#include "core/protobuf_logging.hpp"
+#include "robot_command_batcher.hpp"
+
+namespace ssl_ros_bridge::simulator_bridge
+{
+
+class SimulatorRobotControlNode : public rclcpp::Node
+{
+public:
+  explicit SimulatorRobotControlNode(const rclcpp::NodeOptions & options)
+  : rclcpp::Node("simulator_robot_control", options),
+    simulator_address_(declare_parameter<std::string>("simulator.address", "127.0.0.1"))
+  {
+    SET_ROS_PROTOBUF_LOG_HANDLER("simulator_robot_control.protobuf");
+
+    const auto control_rate = declare_parameter<double>("control_rate", 100.0);
+    if (control_rate <= 0.0) {
+      throw std::invalid_argument("The control_rate parameter must be positive.");
+    }
+
+    AddTeam("blue", declare_parameter<int>("simulator.blue_port", 10301));
+    AddTeam("yellow", declare_parameter<int>("simulator.yellow_port", 10302));
+
+    control_timer_ = create_wall_timer(
+      std::chrono::duration<double>(1.0 / control_rate),
+      std::bind(&SimulatorRobotControlNode::SendBatches, this));
+
+    diagnostics_publisher_ = create_publisher<diagnostic_msgs::msg::DiagnosticArray>(
+      "/diagnostics", rclcpp::SystemDefaultsQoS());
+    const auto diagnostics_period = declare_parameter<double>("diagnostics.period", 1.0);
+    diagnostics_timer_ = create_wall_timer(
+      std::chrono::duration<double>(diagnostics_period),
+      std::bind(&SimulatorRobotControlNode::PublishDiagnostics, this));
+
+    RCLCPP_INFO(
+      get_logger(), "Sending robot commands to the simulator at %s at %.1f Hz",
+      simulator_address_.c_str(), control_rate);
+  }
+
+private:
+  // Enough to hold a command from every robot of a team for a couple of ticks
+  static constexpr std::size_t kCommandQueueDepth = 32;
+
+  struct Team
+  {
+    std::string name;
+    uint16_t simulator_port;
+    RobotCommandBatcher batcher;
+    // Only accessed from the control timer, reused to avoid allocating every tick
+    RobotControl control;
+    std::string datagram;
+    std::atomic<uint64_t> responses{0};
+    std::atomic<uint64_t> simulator_errors{0};
+    rclcpp::Subscription<ssl_league_msgs::msg::RobotCommand>::SharedPtr command_subscription;
+    rclcpp::Subscription<ssl_league_msgs::msg::RobotControl>::SharedPtr control_subscription;
+    rclcpp::Publisher<ssl_league_msgs::msg::RobotControlResponse>::SharedPtr response_publisher;
+    std::unique_ptr<core::MulticastReceiver> receiver;
+  };
+
+  const std::string simulator_address_;
+  std::vector<std::unique_ptr<Team>> teams_;
+  rclcpp::TimerBase::SharedPtr control_timer_;
+  rclcpp::Publisher<diagnostic_msgs::msg::DiagnosticArray>::SharedPtr diagnostics_publisher_;
+  rclcpp::TimerBase::SharedPtr diagnostics_timer_;
+
+  void AddTeam(const std::string & name, const int simulator_port)
+  {
+    auto team = std::make_unique<Team>();
+    auto & team_ref = *team;
+    team->name = name;
+    team->simulator_port = simulator_port;
+    team->command_subscription = create_subscription<ssl_league_msgs::msg::RobotCommand>(
+      "~/" + name + "/robot_command", rclcpp::QoS(kCommandQueueDepth),
+      [&team_ref](const ssl_league_msgs::msg::RobotCommand & msg) {
+        team_ref.batcher.Add(message_conversion::toProto(msg));
+      });
+    team->control_subscription = create_subscription<ssl_league_msgs::msg::RobotControl>(
+      "~/" + name + "/robot_control", rclcpp::QoS(kCommandQueueDepth),
+      [&team_ref](const ssl_league_msgs::msg::RobotControl & msg) {
+        for (const auto & command : msg.robot_commands) {
+          team_ref.batcher.Add(message_conversion::toProto(command));
+        }
+      });
+    team->response_publisher = create_publisher<ssl_league_msgs::msg::RobotControlResponse>(
+      "~/" + name + "/robot_control_response", rclcpp::SystemDefaultsQoS());
+    // The simulator answers to the port each team's commands were sent from, so every team gets
+    // its own socket on an ephemeral port
+    team->receiver = std::make_unique<core::MulticastReceiver>(
+      "0.0.0.0", 0,
+      [this, &team_ref](const std::string &, const uint16_t, uint8_t * data, size_t length,
+      std::chrono::system_clock::time_point) {
+        PublishResponse(team_ref, data, length);
+      },
+      "",
+      [this](const std::string & message) {
+        RCLCPP_WARN(get_logger(), "%s", message.c_str());
+      });
+    teams_.push_back(std::move(team));
+  }
+
+  void SendBatches()
+  {
+    for (auto & team : teams_) {
+      if (!team->batcher.TakeBatch(team->control)) {
+        continue;
+      }
+      team->control.SerializeToString(&team->datagram);
+      team->receiver->SendTo(
+        simulator_address_, team->simulator_port, team->datagram.data(), team->datagram.size());
+    }
+  }
+
+  void PublishResponse(Team & team, const uint8_t * data, const size_t length)
+  {
+    RobotControlResponse response;
+    if (!response.ParseFromArray(data, length)) {
+      RCLCPP_WARN(get_logger(), "Failed to parse robot control response from the simulator");
+      return;
+    }
+    team.responses++;
+    team.simulator_errors += response.errors_size();
+    for (const auto & error : response.errors()) {
+      RCLCPP_WARN_THROTTLE(
+        get_logger(), *get_clock(), 1000, "Simulator error for %s team: %s (%s)",
+        team.name.c_str(), error.message().c_str(), error.code().c_str());
+    }
+    team.response_publisher->publish(message_conversion::fromProto(response));
+  }
+
+  void PublishDiagnostics()
+  {
+    using diagnostic_msgs::msg::DiagnosticStatus;
+    diagnostic_msgs::msg::DiagnosticArray diagnostics_msg;
+    diagnostics_msg.header.stamp = now();
+    for (const auto & team : teams_) {
+      const auto metrics = team->batcher.GetMetrics();
+      DiagnosticStatus status;
+      status.name = std::string(get_name()) + ": " + team->name + " robot control";
+      status.hardware_id = "simulator";
+      if (metrics.sent_batches > 0 && team->responses == 0) {
+        status.level = DiagnosticStatus::WARN;
+        status.message = "No responses from the simulator";
+      } else {
+        status.level = DiagnosticStatus::OK;
+        status.message = metrics.sent_batches == 0 ? "No robot commands received" : "OK";
+      }
+      auto add_value = [&status](const std::string & key, const uint64_t value) {
+          diagnostic_msgs::msg::KeyValue key_value;
+          key_value.key = key;
+          key_value.value = std::to_string(value);
+          status.values.push_back(key_value);
+        };
+      add_value("received_commands", metrics.received_commands);
+      add_value("superseded_commands", metrics.superseded_commands);
+      add_value("sent_packets", metrics.sent_batches);
+      add_value("responses", team->responses);
+      add_value("simulator_errors", team->simulator_errors);
+      diagnostics_msg.status.push_back(status);
+    }
+    diagnostics_publisher_->publish(diagnostics_msg);
+  }
+};
+
+}  // namespace ssl_ros_bridge::simulator_bridge
+
+RCLCPP_COMPONENTS_REGISTER_NODE(ssl_ros_bridge::simulator_bridge::SimulatorRobotControlNode)
@@ -0,0 +1,112 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "delimited_message_decoder.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ssl_ros_bridge::game_controller_bridge
+{
+
+namespace
+{
+// A 32 bit length takes at most five varint bytes
+constexpr std::size_t kMaxLengthPrefixSize = 5;
+}  // namespace
+
+DelimitedMessageDecoder::DelimitedMessageDecoder(
+  const std::size_t initial_capacity,
+  const std::size_t max_message_size)
+: buffer_(std::max<std::size_t>(initial_capacity, kMaxLengthPrefixSize)),
+  max_message_size_(max_message_size)
+{
+}
+
+std::span<uint8_t> DelimitedMessageDecoder::PrepareWrite(const std::size_t min_size)
+{
+  if (buffer_.size() - write_index_ < min_size) {
+    // Reclaim consumed space at the front before growing
+    const auto buffered_size = GetBufferedSize();
+    std::memmove(buffer_.data(), buffer_.data() + read_index_, buffered_size);
+    read_index_ = 0;
+    write_index_ = buffered_size;
+    if (buffer_.size() - write_index_ < min_size) {
+      buffer_.resize(std::max(buffer_.size() * 2, write_index_ + min_size));
+    }
+  }
+  return std::span<uint8_t>(buffer_).subspan(write_index_);
+}
+
+void DelimitedMessageDecoder::CommitWrite(const std::size_t bytes_written)
+{
+  write_index_ = std::min(write_index_ + bytes_written, buffer_.size());
+}
+
+DelimitedMessageDecoder::Status DelimitedMessageDecoder::Next(
+  google::protobuf::MessageLite & message)
+{
+  uint64_t message_size = 0;
+  std::size_t prefix_size = 0;
+  bool prefix_complete = false;
+  while (read_index_ + prefix_size < write_index_) {
+    const auto byte = buffer_[read_index_ + prefix_size];
+    message_size |= static_cast<uint64_t>(byte & 0x7F) << (7 * prefix_size);
+    prefix_size++;
+    if ((byte & 0x80) == 0) {
+      prefix_complete = true;
+      break;
+    }
+    if (prefix_size == kMaxLengthPrefixSize) {
+      Reset();
+      return Status::Error;
+    }
+  }
+  if (!prefix_complete) {
+    return Status::Incomplete;
+  }
+  if (message_size > max_message_size_) {
+    Reset();
+    return Status::Error;
+  }
+  if (GetBufferedSize() < prefix_size + message_size) {
+    return Status::Incomplete;
+  }
+
+  const auto message_start = buffer_.data() + read_index_ + prefix_size;
+  read_index_ += prefix_size + message_size;
+  if (read_index_ == write_index_) {
+    read_index_ = 0;
+    write_index_ = 0;
+  }
+  // Parsing happens before the next write, so the message bytes are still intact
+  if (!message.ParseFromArray(message_start, static_cast<int>(message_size))) {
+    return Status::Error;
+  }
+  return Status::Complete;
+}
+
+void DelimitedMessageDecoder::Reset()
+{
+  read_index_ = 0;
+  write_index_ = 0;
+}
+
+}  // namespace ssl_ros_bridge::game_controller_bridge
@@ -0,0 +1,98 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef TEAM_CLIENT__DELIMITED_MESSAGE_DECODER_HPP_
+#define TEAM_CLIENT__DELIMITED_MESSAGE_DECODER_HPP_
+
+#include <google/protobuf/message_lite.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace ssl_ros_bridge::game_controller_bridge
+{
+
+/**
+ * Splits a stream of bytes into varint length-delimited protobuf messages.
+ *
+ * Bytes are written directly into the decoder's buffer by socket reads. Every complete message in
+ * the buffer can be extracted, and a partial message is kept until the rest of it arrives. The
+ * buffer reclaims consumed space before growing, so steady traffic reuses the same storage.
+ */
+class DelimitedMessageDecoder
+{
+public:
+  enum class Status
+  {
+    /// A message was extracted
+    Complete,
+    /// More bytes are needed for the next message
+    Incomplete,
+    /// The next message was invalid and has been discarded, or the stream is corrupt
+    Error
+  };
+
+  /**
+   * @param initial_capacity Starting size of the buffer in bytes
+   * @param max_message_size Length prefixes above this are treated as a corrupt stream
+   */
+  explicit DelimitedMessageDecoder(
+    const std::size_t initial_capacity = 1024,
+    const std::size_t max_message_size = 1 << 20);
+
+  /**
+   * Returns space for at least min_size new bytes, growing the buffer if needed.
+   *
+   * The span is valid until the next call to any non-const method.
+   */
+  std::span<uint8_t> PrepareWrite(const std::size_t min_size);
+
+  /**
+   * Marks bytes written into the span from PrepareWrite() as received.
+   */
+  void CommitWrite(const std::size_t bytes_written);
+
+  /**
+   * Parses the next complete message, if there is one, into message.
+   */
+  Status Next(google::protobuf::MessageLite & message);
+
+  /**
+   * Discards all buffered bytes. Call when the underlying connection changes.
+   */
+  void Reset();
+
+  std::size_t GetBufferedSize() const
+  {
+    return write_index_ - read_index_;
+  }
+
+private:
+  std::vector<uint8_t> buffer_;
+  std::size_t read_index_{0};
+  std::size_t write_index_{0};
+  const std::size_t max_message_size_;
+};
+
+}  // namespace ssl_ros_bridge::game_controller_bridge
+
+#endif  // TEAM_CLIENT__DELIMITED_MESSAGE_DECODER_HPP_
@@ -20,53 +20,97 @@
 
 #include "team_client.hpp"
 #include <google/protobuf/util/delimited_message_util.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <sstream>
 #include <string>
+#include <utility>
 
 namespace ssl_ros_bridge::game_controller_bridge
 {
 
 TeamClient::TeamClient(rclcpp::Logger logger)
+: TeamClient(logger,
+    ReconnectOptions{std::chrono::milliseconds(10), std::chrono::milliseconds(100)}, nullptr)
+{
+}
+
+TeamClient::TeamClient(
+  rclcpp::Logger logger, const ReconnectOptions & reconnect_options,
+  ConnectionStateCallback state_callback)
 : logger_(logger),
-  socket_(io_service_)
+  reconnect_options_(reconnect_options),
+  state_callback_(std::move(state_callback)),
+  round_trip_time_ms_(kStatisticsBucketWidthMs, kStatisticsBucketCount),
+  previous_round_trip_time_ms_(kStatisticsBucketWidthMs, kStatisticsBucketCount),
+  jitter_ms_(kStatisticsBucketWidthMs, kStatisticsBucketCount),
+  previous_jitter_ms_(kStatisticsBucketWidthMs, kStatisticsBucketCount),
+  statistics_window_start_(std::chrono::steady_clock::now()),
+  random_engine_(std::random_device{}()),
+  work_guard_(boost::asio::make_work_guard(io_service_)),
+  socket_(io_service_),
+  reply_timer_(io_service_),
+  reconnect_timer_(io_service_)
 {
+  io_service_thread_ = std::thread(
+    [this]() {
+      io_service_.run();
+    });
 }
 
-bool TeamClient::Connect(const ConnectionParameters & parameters)
+TeamClient::~TeamClient()
 {
-  connected_ = false;
-  if (!AttemptToConnectSocket(parameters.address, parameters.port)) {
-    return false;
+  io_service_.stop();
+  if (io_service_thread_.joinable()) {
+    io_service_thread_.join();
   }
-  if (!AttemptToRegister(parameters.team_name, parameters.team_color)) {
-    socket_.close();
-    return false;
-  }
-  RCLCPP_INFO(logger_, "Team client connected to Game Controller!");
-  connected_ = true;
-  return true;
+}
+
+void TeamClient::Connect(const ConnectionParameters & parameters, ConnectCallback callback)
+{
+  boost::asio::post(
+    io_service_, [this, parameters, callback = std::move(callback)]() {
+      reconnect_parameters_ = parameters;
+      reconnect_attempt_count_ = 0;
+      StartConnect(parameters, std::move(callback));
+    });
 }
 
 void TeamClient::Disconnect()
 {
-  connected_ = false;
-  socket_.close();
+  boost::asio::post(
+    io_service_, [this]() {
+      reconnect_parameters_.reset();
+      reconnect_timer_.cancel();
+      SetState(ConnectionState::Disconnected);
+      CloseConnection();
+    });
 }
 
-TeamClient::Result TeamClient::SetDesiredKeeper(const int keeper_id)
+void TeamClient::SetDesiredKeeper(const int keeper_id, ResultCallback callback)
 {
   TeamToController team_to_controller;
   team_to_controller.set_desired_keeper(keeper_id);
-  return SendRequest(team_to_controller);
+  SendRequest(
+    std::move(team_to_controller),
+    [this, callback = std::move(callback)](const ControllerToTeam * reply) {
+      callback(ToResult(reply));
+    });
 }
 
-TeamClient::Result TeamClient::RequestBotSubstitution()
+void TeamClient::RequestBotSubstitution(ResultCallback callback)
 {
   TeamToController team_to_controller;
   team_to_controller.set_substitute_bot(true);
-  return SendRequest(team_to_controller);
+  SendRequest(
+    std::move(team_to_controller),
+    [this, callback = std::move(callback)](const ControllerToTeam * reply) {
+      callback(ToResult(reply));
+    });
 }
 
-TeamClient::Result TeamClient::SetAdvantageChoice(const AdvantageChoiceOption & choice)
+void TeamClient::SetAdvantageChoice(const AdvantageChoiceOption & choice, ResultCallback callback)
 {
   TeamToController team_to_controller;
   switch (choice) {
@@ -77,76 +121,93 @@ TeamClient::Result TeamClient::SetAdvantageChoice(const AdvantageChoiceOption &
       team_to_controller.set_advantage_choice(CONTINUE);
       break;
   }
-  return SendRequest(team_to_controller);
+  SendRequest(
+    std::move(team_to_controller),
+    [this, callback = std::move(callback)](const ControllerToTeam * reply) {
+      callback(ToResult(reply));
+    });
 }
 
-TeamClient::PingResult TeamClient::Ping()
+void TeamClient::Ping(PingCallback callback)
 {
   TeamToController team_to_controller;
   team_to_controller.set_ping(true);
-  PingResult result;
   const auto send_time = std::chrono::steady_clock::now();
-  result.request_result = SendRequest(team_to_controller);
-  result.ping = std::chrono::steady_clock::now() - send_time;
-  return result;
+  SendRequest(
+    std::move(team_to_controller),
+    [this, send_time, callback = std::move(callback)](const ControllerToTeam * reply) {
+      PingResult result;
+      result.request_result = ToResult(reply);
+      result.ping = std::chrono::steady_clock::now() - send_time;
+      callback(result);
+    });
 }
 
-bool TeamClient::AttemptToConnectSocket(
-  const boost::asio::ip::address & address,
-  const uint16_t port)
+void TeamClient::SetState(const ConnectionState state)
 {
-  if (socket_.is_open()) {
-    socket_.close();
-  }
-  boost::system::error_code error_code;
-  RCLCPP_INFO(logger_, "Connecting to game controller at %s:%d", address.to_string().c_str(), port);
-  socket_.connect(boost::asio::ip::tcp::endpoint(address, port), error_code);
-  if (error_code) {
-    RCLCPP_WARN(logger_, "Team client connect failed: %s", error_code.message().c_str());
-    return false;
-  }
-
-  ControllerToTeam controller_to_team;
-  if (!WaitForReply(controller_to_team)) {
-    return false;
-  }
-
-  if (!controller_to_team.has_controller_reply()) {
-    RCLCPP_ERROR(logger_, "Got ControllerToTeam message with no ControllerReply payload!");
-    return false;
-  }
-
-  const auto & controller_reply = controller_to_team.controller_reply();
-
-  if (controller_reply.has_status_code() && controller_reply.status_code() != ControllerReply::OK) {
-    if (controller_reply.has_reason()) {
-      RCLCPP_ERROR(
-        logger_, "Game controller sent bad status code (%d) with reason: %s",
-        controller_reply.status_code(), controller_reply.reason().c_str());
-    } else {
-      RCLCPP_ERROR(
-        logger_, "Game controller sent bad status code: %d",
-        controller_reply.status_code());
-    }
-    socket_.close();
-    return false;
+  if (state_.exchange(state) != state && state_callback_) {
+    state_callback_(state);
   }
+}
 
-  if (!controller_reply.has_next_token()) {
-    RCLCPP_ERROR(logger_, "Controller reply did not include a token!");
-  } else {
-    next_token_ = controller_reply.next_token();
+void TeamClient::StartConnect(const ConnectionParameters & parameters, ConnectCallback callback)
+{
+  reconnect_timer_.cancel();
+  SetState(ConnectionState::Connecting);
+  CloseConnection();
+  if (reconnect_attempt_count_ == 0) {
+    RCLCPP_INFO(
+      logger_, "Connecting to game controller at %s:%d", parameters.address.to_string().c_str(),
+      parameters.port);
   }
-
-  return true;
+  // The greeting's deadline also bounds how long the TCP connect may take
+  ExpectReply(
+    [this, parameters, callback = std::move(callback)](const ControllerToTeam * reply) {
+      if (reply == nullptr) {
+        // The connection failed and a retry has already been scheduled
+        callback(false);
+        return;
+      }
+      if (!CheckHandshakeReply(reply)) {
+        RejectConnection();
+        callback(false);
+        return;
+      }
+      if (!reply->controller_reply().has_next_token()) {
+        RCLCPP_ERROR(logger_, "Controller reply did not include a token!");
+      } else {
+        next_token_ = reply->controller_reply().next_token();
+      }
+      StartRegistration(parameters, callback);
+    });
+  const auto connection_id = connection_id_;
+  socket_.async_connect(
+    boost::asio::ip::tcp::endpoint(parameters.address, parameters.port),
+    [this, connection_id](const boost::system::error_code & error) {
+      if (connection_id != connection_id_) {
+        return;
+      }
+      if (error) {
+        if (reconnect_attempt_count_ == 0) {
+          RCLCPP_WARN(logger_, "Team client connect failed: %s", error.message().c_str());
+        } else {
+          RCLCPP_DEBUG(logger_, "Team client connect failed: %s", error.message().c_str());
+        }
+        HandleConnectionLost();
+        return;
+      }
+      StartRead();
+    });
 }
 
-bool TeamClient::AttemptToRegister(const std::string & team_name, const TeamColor team_color)
+void TeamClient::StartRegistration(
+  const ConnectionParameters & parameters,
+  ConnectCallback callback)
 {
   RCLCPP_INFO(logger_, "Registering team...");
   TeamRegistration team_registration_msg;
-  team_registration_msg.set_team_name(team_name);
-  switch (team_color) {
+  team_registration_msg.set_team_name(parameters.team_name);
+  switch (parameters.team_color) {
     case TeamColor::Blue:
       team_registration_msg.set_team(BLUE);
       break;
@@ -158,31 +219,41 @@ bool TeamClient::AttemptToRegister(const std::string & team_name, const TeamColo
   }
   // team_registration_msg.mutable_signature()->set_token(next_token_);
 
-  boost::asio::streambuf boost_streambuf;
-  std::ostream std_stream(&boost_streambuf);
-  google::protobuf::util::SerializeDelimitedToOstream(team_registration_msg, &std_stream);
-
-  boost::asio::write(socket_, boost_streambuf, boost::asio::transfer_all());
-
-  ControllerToTeam controller_to_team;
-  if (!WaitForReply(controller_to_team)) {
-    return false;
-  }
+  Send(team_registration_msg);
+  ExpectReply(
+    [this, callback](const ControllerToTeam * reply) {
+      if (reply == nullptr) {
+        callback(false);
+        return;
+      }
+      if (!CheckHandshakeReply(reply)) {
+        RejectConnection();
+        callback(false);
+        return;
+      }
+      RCLCPP_INFO(logger_, "Team client connected to Game Controller!");
+      reconnect_attempt_count_ = 0;
+      SetState(ConnectionState::Connected);
+      callback(true);
+    });
+}
 
-  if (!controller_to_team.has_controller_reply()) {
+bool TeamClient::CheckHandshakeReply(const ControllerToTeam * reply)
+{
+  if (!reply->has_controller_reply()) {
     RCLCPP_ERROR(logger_, "Got ControllerToTeam message with no ControllerReply payload!");
     return false;
   }
 
-  const auto & controller_reply = controller_to_team.controller_reply();
+  const auto & controller_reply = reply->controller_reply();
 
   if (controller_reply.has_status_code() && controller_reply.status_code() != ControllerReply::OK) {
     if (controller_reply.has_reason()) {
-      RCLCPP_WARN(
+      RCLCPP_ERROR(
         logger_, "Game controller sent bad status code (%d) with reason: %s",
         controller_reply.status_code(), controller_reply.reason().c_str());
     } else {
-      RCLCPP_WARN(
+      RCLCPP_ERROR(
         logger_, "Game controller sent bad status code: %d",
         controller_reply.status_code());
     }
@@ -192,66 +263,31 @@ bool TeamClient::AttemptToRegister(const std::string & team_name, const TeamColo
   return true;
 }
 
-bool TeamClient::WaitForReply(ControllerToTeam & reply)
+void TeamClient::SendRequest(TeamToController request, ReplyHandler handler)
 {
-  boost::system::error_code error_code;
-  rclcpp::WallRate retry_rate(10 /*Hz*/);
-  std::size_t bytes_received = 0;
-  const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(1);
-  while (true) {
-    if (std::chrono::steady_clock::now() >= timeout) {
-      RCLCPP_ERROR(logger_, "Team client timed out waiting for a reply!");
-      return false;
-    }
-    const auto bytes_available = socket_.available(error_code);
-    if (error_code && error_code != boost::asio::error::eof) {
-      RCLCPP_ERROR(logger_, "Team client TCP error: %s", error_code.message().c_str());
-      return false;
-    }
-    if (bytes_available == 0) {
-      retry_rate.sleep();
-      continue;
-    }
-    bytes_received = boost::asio::read(
-      socket_, boost::asio::buffer(
-        buffer_), boost::asio::transfer_at_least(bytes_available), error_code);
-    if (error_code && error_code != boost::asio::error::eof) {
-      RCLCPP_ERROR(logger_, "Team client TCP error: %s", error_code.message().c_str());
-      return false;
-    }
-    break;
-  }
-  google::protobuf::io::ArrayInputStream array_input_stream(buffer_.data(), bytes_received);
-  if (!google::protobuf::util::ParseDelimitedFromZeroCopyStream(
-      &reply, &array_input_stream,
-      nullptr))
-  {
-    RCLCPP_ERROR(logger_, "Team client could not parse reply message.");
-    return false;
-  }
-
-  return true;
+  boost::asio::post(
+    io_service_, [this, request = std::move(request), handler = std::move(handler)]() {
+      if (state_ != ConnectionState::Connected) {
+        handler(nullptr);
+        return;
+      }
+      Send(request);
+      ExpectReply(std::move(handler), true);
+    });
 }
 
-TeamClient::Result TeamClient::SendRequest(TeamToController & request)
+TeamClient::Result TeamClient::ToResult(const ControllerToTeam * reply)
 {
-  boost::asio::streambuf boost_streambuf;
-  std::ostream std_stream(&boost_streambuf);
-  google::protobuf::util::SerializeDelimitedToOstream(request, &std_stream);
-
-  boost::asio::write(socket_, boost_streambuf, boost::asio::transfer_all());
-
-  ControllerToTeam controller_to_team;
-  if (!WaitForReply(controller_to_team)) {
+  if (reply == nullptr) {
     return {false, "Client error."};
   }
 
-  if (!controller_to_team.has_controller_reply()) {
+  if (!reply->has_controller_reply()) {
     RCLCPP_ERROR(logger_, "Got ControllerToTeam message with no ControllerReply payload!");
     return {false, "Client error."};
   }
 
-  const auto & controller_reply = controller_to_team.controller_reply();
+  const auto & controller_reply = reply->controller_reply();
 
   if (controller_reply.has_next_token()) {
     next_token_ = controller_reply.next_token();
@@ -266,4 +302,246 @@ TeamClient::Result TeamClient::SendRequest(TeamToController & request)
   return result;
 }
 
+void TeamClient::Send(const google::protobuf::MessageLite & message)
+{
+  std::ostringstream stream;
+  google::protobuf::util::SerializeDelimitedToOstream(message, &stream);
+  write_queue_.push_back(stream.str());
+  // Only one write may be in flight, or messages could interleave on the wire
+  if (write_queue_.size() == 1) {
+    StartWrite();
+  }
+}
+
+void TeamClient::ExpectReply(ReplyHandler handler, const bool is_request)
+{
+  const auto now = std::chrono::steady_clock::now();
+  pending_replies_.push_back({std::move(handler), now, now + kReplyTimeout, is_request});
+  pending_request_count_ = pending_replies_.size();
+  if (pending_replies_.size() == 1) {
+    ArmReplyTimer();
+  }
+}
+
+void TeamClient::StartWrite()
+{
+  const auto connection_id = connection_id_;
+  boost::asio::async_write(
+    socket_, boost::asio::buffer(write_queue_.front()),
+    [this, connection_id](const boost::system::error_code & error, std::size_t) {
+      if (connection_id != connection_id_) {
+        return;
+      }
+      if (error) {
+        RCLCPP_ERROR(logger_, "Team client TCP error: %s", error.message().c_str());
+        HandleConnectionLost();
+        return;
+      }
+      write_queue_.pop_front();
+      if (!write_queue_.empty()) {
+        StartWrite();
+      }
+    });
+}
+
+void TeamClient::StartRead()
+{
+  const auto read_buffer = decoder_.PrepareWrite(kReadSize);
+  const auto connection_id = connection_id_;
+  socket_.async_read_some(
+    boost::asio::buffer(read_buffer.data(), read_buffer.size()),
+    [this, connection_id](const boost::system::error_code & error, std::size_t bytes_received) {
+      HandleRead(connection_id, error, bytes_received);
+    });
+}
+
+void TeamClient::HandleRead(
+  const uint64_t connection_id, const boost::system::error_code & error,
+  const std::size_t bytes_received)
+{
+  if (connection_id != connection_id_) {
+    return;
+  }
+  if (error == boost::asio::error::eof) {
+    RCLCPP_ERROR(logger_, "Game controller closed the team client connection.");
+    HandleConnectionLost();
+    return;
+  }
+  if (error) {
+    RCLCPP_ERROR(logger_, "Team client TCP error: %s", error.message().c_str());
+    HandleConnectionLost();
+    return;
+  }
+
+  decoder_.CommitWrite(bytes_received);
+  ControllerToTeam reply;
+  while (true) {
+    const auto status = decoder_.Next(reply);
+    if (status == DelimitedMessageDecoder::Status::Incomplete) {
+      break;
+    }
+    if (status == DelimitedMessageDecoder::Status::Error) {
+      RCLCPP_ERROR(logger_, "Team client could not parse reply message.");
+      HandleConnectionLost();
+      return;
+    }
+    if (pending_replies_.empty()) {
+      RCLCPP_WARN(logger_, "Team client got a reply with no request waiting for it.");
+      continue;
+    }
+    auto pending_reply = std::move(pending_replies_.front());
+    pending_replies_.pop_front();
+    pending_request_count_ = pending_replies_.size();
+    if (pending_reply.is_request) {
+      RecordRoundTripTime(std::chrono::steady_clock::now() - pending_reply.send_time);
+    }
+    pending_reply.handler(&reply);
+    if (connection_id != connection_id_) {
+      // The handler closed this connection
+      return;
+    }
+  }
+
+  ArmReplyTimer();
+  StartRead();
+}
+
+void TeamClient::ArmReplyTimer()
+{
+  if (pending_replies_.empty()) {
+    reply_timer_.cancel();
+    return;
+  }
+  const auto connection_id = connection_id_;
+  reply_timer_.expires_at(pending_replies_.front().deadline);
+  reply_timer_.async_wait(
+    [this, connection_id](const boost::system::error_code & error) {
+      if (error == boost::asio::error::operation_aborted || connection_id != connection_id_) {
+        return;
+      }
+      if (pending_replies_.empty()) {
+        return;
+      }
+      if (pending_replies_.front().deadline > std::chrono::steady_clock::now()) {
+        ArmReplyTimer();
+        return;
+      }
+      if (pending_replies_.front().is_request) {
+        std::lock_guard lock(statistics_mutex_);
+        timeout_count_++;
+      }
+      // Replies carry no request ID, so a late reply would be matched to the wrong request
+      if (reconnect_attempt_count_ == 0) {
+        RCLCPP_ERROR(logger_, "Team client timed out waiting for a reply!");
+      } else {
+        RCLCPP_DEBUG(logger_, "Team client timed out waiting for a reply!");
+      }
+      HandleConnectionLost();
+    });
+}
+
+void TeamClient::CloseConnection()
+{
+  connection_id_++;
+  boost::system::error_code error_code;
+  socket_.close(error_code);
+  reply_timer_.cancel();
+  decoder_.Reset();
+  write_queue_.clear();
+  auto failed_replies = std::move(pending_replies_);
+  pending_replies_.clear();
+  pending_request_count_ = 0;
+  for (auto & pending_reply : failed_replies) {
+    pending_reply.handler(nullptr);
+  }
+}
+
+TeamClient::LinkStatistics TeamClient::GetLinkStatistics()
+{
+  std::lock_guard lock(statistics_mutex_);
+  RotateStatisticsWindows(std::chrono::steady_clock::now());
+  LinkStatistics statistics{previous_round_trip_time_ms_, previous_jitter_ms_, timeout_count_,
+    pending_request_count_};
+  statistics.round_trip_time_ms.Merge(round_trip_time_ms_);
+  statistics.jitter_ms.Merge(jitter_ms_);
+  return statistics;
+}
+
+void TeamClient::RecordRoundTripTime(const std::chrono::steady_clock::duration round_trip_time)
+{
+  const auto now = std::chrono::steady_clock::now();
+  const auto round_trip_time_ms =
+    std::chrono::duration<double, std::milli>(round_trip_time).count();
+  std::lock_guard lock(statistics_mutex_);
+  RotateStatisticsWindows(now);
+  round_trip_time_ms_.AddSample(round_trip_time_ms);
+  if (last_round_trip_time_ms_) {
+    jitter_ms_.AddSample(std::abs(round_trip_time_ms - *last_round_trip_time_ms_));
+  }
+  last_round_trip_time_ms_ = round_trip_time_ms;
+}
+
+void TeamClient::RotateStatisticsWindows(const std::chrono::steady_clock::time_point now)
+{
+  const auto elapsed = now - statistics_window_start_;
+  if (elapsed < kStatisticsWindow) {
+    return;
+  }
+  if (elapsed < 2 * kStatisticsWindow) {
+    previous_round_trip_time_ms_ = round_trip_time_ms_;
+    previous_jitter_ms_ = jitter_ms_;
+  } else {
+    // Nothing was recorded for a whole window, so the previous window is empty
+    previous_round_trip_time_ms_.Reset();
+    previous_jitter_ms_.Reset();
+  }
+  round_trip_time_ms_.Reset();
+  jitter_ms_.Reset();
+  statistics_window_start_ = now;
+}
+
+void TeamClient::RejectConnection()
+{
+  RCLCPP_ERROR(logger_, "Game controller refused the team client. Not reconnecting automatically.");
+  reconnect_parameters_.reset();
+  SetState(ConnectionState::Disconnected);
+  CloseConnection();
+}
+
+void TeamClient::HandleConnectionLost()
+{
+  // Update the state first so callbacks of failed requests see the connection is down
+  ScheduleReconnect();
+  CloseConnection();
+}
+
+void TeamClient::ScheduleReconnect()
+{
+  if (!reconnect_parameters_) {
+    SetState(ConnectionState::Disconnected);
+    return;
+  }
+  if (reconnect_attempt_count_ == 0) {
+    RCLCPP_WARN(logger_, "Team client will keep retrying the game controller at its last address.");
+  }
+  auto backoff = reconnect_options_.initial_backoff;
+  for (int i = 0; i < reconnect_attempt_count_ && backoff < reconnect_options_.max_backoff; ++i) {
+    backoff *= 2;
+  }
+  backoff = std::min(backoff, reconnect_options_.max_backoff);
+  // Jitter keeps clients from retrying in lockstep after the game controller restarts
+  const auto backoff_us = std::chrono::duration_cast<std::chrono::microseconds>(backoff).count();
+  std::uniform_int_distribution<int64_t> distribution(backoff_us / 2, backoff_us);
+  reconnect_attempt_count_++;
+  SetState(ConnectionState::WaitingToReconnect);
+  reconnect_timer_.expires_after(std::chrono::microseconds(distribution(random_engine_)));
+  reconnect_timer_.async_wait(
+    [this](const boost::system::error_code & error) {
+      if (error == boost::asio::error::operation_aborted || !reconnect_parameters_) {
+        return;
+      }
+      StartConnect(*reconnect_parameters_, [](bool) {});
+    });
+}
+
 }  // namespace ssl_ros_bridge::game_controller_bridge
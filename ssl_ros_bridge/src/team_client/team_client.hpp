@@ -22,17 +22,29 @@
 #define TEAM_CLIENT__TEAM_CLIENT_HPP_
 
 #include <ssl_league_protobufs/ssl_gc_rcon_team.pb.h>
-#include <array>
 #include <atomic>
+#include <deque>
+#include <functional>
 #include <mutex>
+#include <optional>
+#include <random>
 #include <string>
-#include <vector>
+#include <thread>
 #include <boost/asio.hpp>
 #include <rclcpp/rclcpp.hpp>
+#include "core/histogram.hpp"
+#include "delimited_message_decoder.hpp"
 
 namespace ssl_ros_bridge::game_controller_bridge
 {
 
+/**
+ * Client for the game controller's team remote control protocol.
+ *
+ * All socket work happens on the client's own IO thread. Requests are sent as soon as they are
+ * made, and replies are matched to requests in the order they were sent. Callbacks run on the IO
+ * thread and should not block.
+ */
 class TeamClient
 {
 public:
@@ -69,41 +81,202 @@ public:
     Continue
   };
 
+  enum class ConnectionState
+  {
+    Disconnected,
+    Connecting,
+    Connected,
+    /// The connection was lost and the client is waiting to retry the last address
+    WaitingToReconnect
+  };
+
+  /**
+   * Retry delays after a lost connection. Each failed attempt doubles the delay up to the
+   * maximum, and the actual delay is drawn from the upper half of that range.
+   */
+  struct ReconnectOptions
+  {
+    std::chrono::milliseconds initial_backoff;
+    std::chrono::milliseconds max_backoff;
+  };
+
+  /**
+   * @param connected True if the client connected and registered successfully
+   */
+  using ConnectCallback = std::function<void (bool connected)>;
+
+  using ResultCallback = std::function<void (const Result & result)>;
+
+  using PingCallback = std::function<void (const PingResult & result)>;
+
+  /**
+   * Link quality over the current and previous statistics windows.
+   */
+  struct LinkStatistics
+  {
+    /// Round trip times of requests, in milliseconds
+    core::Histogram round_trip_time_ms;
+    /// Absolute change between consecutive round trip times, in milliseconds
+    core::Histogram jitter_ms;
+    /// Requests which timed out since the client was created
+    uint64_t timeout_count;
+    /// Requests sent and still waiting for a reply
+    std::size_t pending_request_count;
+  };
+
+  using ConnectionStateCallback = std::function<void (ConnectionState state)>;
+
   explicit TeamClient(rclcpp::Logger logger);
 
-  bool Connect(const ConnectionParameters & parameters);
+  /**
+   * @param state_callback Called on the IO thread whenever the connection state changes
+   */
+  TeamClient(
+    rclcpp::Logger logger, const ReconnectOptions & reconnect_options,
+    ConnectionStateCallback state_callback);
+
+  ~TeamClient();
+
+  /**
+   * Connects and registers with the game controller, closing any existing connection first.
+   *
+   * The callback reports the outcome of the first attempt. If the connection cannot be made or is
+   * lost later, the client keeps retrying these parameters until Disconnect() or Connect() is
+   * called again. A game controller refusing the registration is not retried.
+   */
+  void Connect(const ConnectionParameters & parameters, ConnectCallback callback);
 
+  /**
+   * Closes the connection and stops reconnecting.
+   */
   void Disconnect();
 
   bool IsConnected() const
   {
-    return connected_;
+    return state_ == ConnectionState::Connected;
   }
 
-  Result SetDesiredKeeper(const int keeper_id);
+  ConnectionState GetConnectionState() const
+  {
+    return state_;
+  }
+
+  /**
+   * Returns request statistics covering the last one to two statistics windows. Thread safe.
+   */
+  LinkStatistics GetLinkStatistics();
+
+  void SetDesiredKeeper(const int keeper_id, ResultCallback callback);
 
-  Result RequestBotSubstitution();
+  void RequestBotSubstitution(ResultCallback callback);
 
-  Result SetAdvantageChoice(const AdvantageChoiceOption & choice);
+  void SetAdvantageChoice(const AdvantageChoiceOption & choice, ResultCallback callback);
 
-  PingResult Ping();
+  void Ping(PingCallback callback);
 
 private:
+  /**
+   * @param reply The matched reply, or nullptr if the connection failed before it arrived
+   */
+  using ReplyHandler = std::function<void (const ControllerToTeam * reply)>;
+
+  struct PendingReply
+  {
+    ReplyHandler handler;
+    std::chrono::steady_clock::time_point send_time;
+    std::chrono::steady_clock::time_point deadline;
+    /// False for handshake replies, which are not answers to timed requests
+    bool is_request;
+  };
+
+  const std::chrono::seconds kReplyTimeout{1};
+  const std::size_t kReadSize{1024};
+  const std::chrono::seconds kStatisticsWindow{10};
+  // 0.1 ms buckets up to the reply timeout
+  const double kStatisticsBucketWidthMs{0.1};
+  const std::size_t kStatisticsBucketCount{10000};
   rclcpp::Logger logger_;
-  bool connected_{false};
+  const ReconnectOptions reconnect_options_;
+  ConnectionStateCallback state_callback_;
+  std::atomic<ConnectionState> state_{ConnectionState::Disconnected};
+  std::mutex statistics_mutex_;
+  core::Histogram round_trip_time_ms_;
+  core::Histogram previous_round_trip_time_ms_;
+  core::Histogram jitter_ms_;
+  core::Histogram previous_jitter_ms_;
+  std::chrono::steady_clock::time_point statistics_window_start_;
+  std::optional<double> last_round_trip_time_ms_;
+  uint64_t timeout_count_{0};
+  std::atomic_size_t pending_request_count_{0};
+  // Everything below is only touched from the IO thread
+  std::optional<ConnectionParameters> reconnect_parameters_;
+  int reconnect_attempt_count_{0};
+  std::mt19937 random_engine_;
   std::string next_token_;
-  std::array<char, 1024> buffer_;
-  std::size_t buffer_index_{0};
+  // Bumped on every close so handlers from an old connection can tell they are stale
+  uint64_t connection_id_{0};
   boost::asio::io_service io_service_;
+  boost::asio::executor_work_guard<boost::asio::io_service::executor_type> work_guard_;
   boost::asio::ip::tcp::socket socket_;
+  boost::asio::steady_timer reply_timer_;
+  boost::asio::steady_timer reconnect_timer_;
+  DelimitedMessageDecoder decoder_;
+  std::deque<PendingReply> pending_replies_;
+  std::deque<std::string> write_queue_;
+  std::thread io_service_thread_;
+
+  void SetState(const ConnectionState state);
+
+  void StartConnect(const ConnectionParameters & parameters, ConnectCallback callback);
+
+  void StartRegistration(const ConnectionParameters & parameters, ConnectCallback callback);
+
+  /**
+   * Checks a handshake reply, logging the reason it was refused.
+   */
+  bool CheckHandshakeReply(const ControllerToTeam * reply);
+
+  void SendRequest(TeamToController request, ReplyHandler handler);
+
+  Result ToResult(const ControllerToTeam * reply);
+
+  void Send(const google::protobuf::MessageLite & message);
+
+  void ExpectReply(ReplyHandler handler, const bool is_request = false);
+
+  void RecordRoundTripTime(const std::chrono::steady_clock::duration round_trip_time);
+
+  /**
+   * Starts a new statistics window if the current one has ended. Requires statistics_mutex_.
+   */
+  void RotateStatisticsWindows(const std::chrono::steady_clock::time_point now);
+
+  void StartWrite();
+
+  void StartRead();
+
+  void HandleRead(
+    const uint64_t connection_id, const boost::system::error_code & error,
+    const std::size_t bytes_received);
+
+  void ArmReplyTimer();
 
-  bool AttemptToConnectSocket(const boost::asio::ip::address & address, const uint16_t port);
+  /**
+   * Closes the socket and fails every request still waiting for a reply.
+   */
+  void CloseConnection();
 
-  bool AttemptToRegister(const std::string & team_name, const TeamColor team_color);
+  /**
+   * Closes a connection the game controller refused and stops reconnecting.
+   */
+  void RejectConnection();
 
-  bool WaitForReply(ControllerToTeam & reply);
+  /**
+   * Closes a connection which broke and schedules an attempt to restore it.
+   */
+  void HandleConnectionLost();
 
-  Result SendRequest(TeamToController & request);
+  void ScheduleReconnect();
 };
 
 }  // namespace ssl_ros_bridge::game_controller_bridge
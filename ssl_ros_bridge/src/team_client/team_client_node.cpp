@@ -18,7 +18,9 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <memory>
 #include <string>
+#include <utility>
 #include <rclcpp/rclcpp.hpp>
 #include <rclcpp_components/register_node_macro.hpp>
 #include "core/protobuf_logging.hpp"
@@ -36,7 +38,8 @@ class TeamClientNode : public rclcpp::Node
 public:
   explicit TeamClientNode(const rclcpp::NodeOptions & options)
   : rclcpp::Node("team_client_node", options),
-    team_client_(get_logger().get_child("team_client"))
+    team_client_(get_logger().get_child("team_client"), DeclareReconnectOptions(),
+      std::bind(&TeamClientNode::ConnectionStateCallback, this, std::placeholders::_1))
   {
     SET_ROS_PROTOBUF_LOG_HANDLER("team_client_node.protobuf");
 
@@ -45,6 +48,8 @@ public:
     declare_parameter<std::string>("team_name", "Test Team");
     declare_parameter<std::string>("team_color", "auto");
 
+    // Service responses are sent from team client callbacks once the game controller replies, so
+    // the executor never waits on the socket.
     set_desired_keeper_service_ = create_service<ssl_ros_bridge_msgs::srv::SetDesiredKeeper>(
       "~/set_desired_keeper",
       std::bind(
@@ -79,13 +84,15 @@ public:
       std::chrono::duration<double>(ping_period),
       std::bind(&TeamClientNode::PingCallback, this));
 
-    if (!Connect()) {
-      RCLCPP_ERROR(get_logger(), "Failed to connect to Game Controller.");
-    }
+    Connect(
+      [this](bool connected) {
+        if (!connected) {
+          RCLCPP_ERROR(get_logger(), "Failed to connect to Game Controller.");
+        }
+      });
   }
 
 private:
-  TeamClient team_client_;
   rclcpp::Service<ssl_ros_bridge_msgs::srv::SetDesiredKeeper>::SharedPtr
     set_desired_keeper_service_;
   rclcpp::Service<ssl_ros_bridge_msgs::srv::SubstituteBot>::SharedPtr substitute_bot_service_;
@@ -95,14 +102,56 @@ private:
   rclcpp::Publisher<ssl_ros_bridge_msgs::msg::TeamClientConnectionStatus>::SharedPtr
     connection_status_publisher_;
   rclcpp::TimerBase::SharedPtr ping_timer_;
+  // Declared last so its IO thread stops before the members its callbacks use are destroyed
+  TeamClient team_client_;
 
-  bool Connect()
+  TeamClient::ReconnectOptions DeclareReconnectOptions()
+  {
+    const auto to_milliseconds = [](const double seconds) {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::duration<double>(seconds));
+      };
+    TeamClient::ReconnectOptions options;
+    options.initial_backoff =
+      to_milliseconds(declare_parameter<double>("reconnect.initial_backoff", 0.01));
+    options.max_backoff = to_milliseconds(declare_parameter<double>("reconnect.max_backoff", 0.1));
+    return options;
+  }
+
+  void ConnectionStateCallback(const TeamClient::ConnectionState state)
+  {
+    // Publish right away instead of waiting for the next ping so losses show up immediately
+    ssl_ros_bridge_msgs::msg::TeamClientConnectionStatus status_msg;
+    status_msg.connected = state == TeamClient::ConnectionState::Connected;
+    FillLinkStatistics(status_msg);
+    connection_status_publisher_->publish(status_msg);
+  }
+
+  void FillLinkStatistics(ssl_ros_bridge_msgs::msg::TeamClientConnectionStatus & status_msg)
+  {
+    const auto statistics = team_client_.GetLinkStatistics();
+    const auto & round_trip_time = statistics.round_trip_time_ms;
+    status_msg.round_trip_time_count = round_trip_time.GetSampleCount();
+    status_msg.round_trip_time_mean = round_trip_time.GetMean();
+    status_msg.round_trip_time_p50 = round_trip_time.GetPercentile(0.5);
+    status_msg.round_trip_time_p90 = round_trip_time.GetPercentile(0.9);
+    status_msg.round_trip_time_p99 = round_trip_time.GetPercentile(0.99);
+    status_msg.round_trip_time_max = round_trip_time.GetMax();
+    status_msg.jitter_mean = statistics.jitter_ms.GetMean();
+    status_msg.jitter_p90 = statistics.jitter_ms.GetPercentile(0.9);
+    status_msg.jitter_max = statistics.jitter_ms.GetMax();
+    status_msg.timeout_count = statistics.timeout_count;
+    status_msg.pending_request_count = statistics.pending_request_count;
+  }
+
+  void Connect(TeamClient::ConnectCallback callback)
   {
     const auto address_string = get_parameter("gc_ip_address").as_string();
     if(address_string.empty()) {
       RCLCPP_WARN(get_logger(), "Address parameter empty. Cannot attempt to connect.");
       // Returning "success" because this isn't a problem during setup.
-      return true;
+      callback(true);
+      return;
     }
     TeamClient::ConnectionParameters connection_parameters;
     connection_parameters.address = boost::asio::ip::address::from_string(address_string);
@@ -116,63 +165,83 @@ private:
     } else if (team_color_name == "yellow") {
       connection_parameters.team_color = TeamClient::TeamColor::Yellow;
     }
-    return team_client_.Connect(connection_parameters);
+    team_client_.Connect(connection_parameters, std::move(callback));
+  }
+
+  /**
+   * Makes a team client callback that sends the result as the response to a deferred request.
+   */
+  template<typename ServiceType>
+  TeamClient::ResultCallback MakeResponder(
+    const std::shared_ptr<rclcpp::Service<ServiceType>> & service,
+    const std::shared_ptr<rmw_request_id_t> & request_header)
+  {
+    return [service, request_header](const TeamClient::Result & result) {
+             typename ServiceType::Response response;
+             response.success = result.accepted;
+             response.reason = result.reason;
+             service->send_response(*request_header, response);
+           };
+  }
+
+  template<typename ServiceType>
+  bool CheckConnected(
+    const std::shared_ptr<rclcpp::Service<ServiceType>> & service,
+    const std::shared_ptr<rmw_request_id_t> & request_header)
+  {
+    if (team_client_.IsConnected()) {
+      return true;
+    }
+    RCLCPP_ERROR(
+      get_logger(), "Service %s called before team client connected.",
+      service->get_service_name());
+    MakeResponder(service, request_header)(
+      {false, "Team client is not connected to the Game Controller."});
+    return false;
   }
 
   void HandleSetDesiredKeeper(
-    const ssl_ros_bridge_msgs::srv::SetDesiredKeeper::Request::SharedPtr request,
-    ssl_ros_bridge_msgs::srv::SetDesiredKeeper::Response::SharedPtr response)
+    const std::shared_ptr<rmw_request_id_t> request_header,
+    const ssl_ros_bridge_msgs::srv::SetDesiredKeeper::Request::SharedPtr request)
   {
-    if (!team_client_.IsConnected()) {
-      response->success = false;
-      response->reason = "Team client is not connected to the Game Controller.";
-      RCLCPP_ERROR(
-        get_logger(), "Service %s called before team client connected.",
-        set_desired_keeper_service_->get_service_name());
+    if (!CheckConnected(set_desired_keeper_service_, request_header)) {
       return;
     }
-    const auto result = team_client_.SetDesiredKeeper(request->desired_keeper);
-    response->success = result.accepted;
-    response->reason = result.reason;
+    team_client_.SetDesiredKeeper(
+      request->desired_keeper,
+      MakeResponder(set_desired_keeper_service_, request_header));
   }
 
   void HandleSubstituteBot(
-    const ssl_ros_bridge_msgs::srv::SubstituteBot::Request::SharedPtr /*request*/,
-    ssl_ros_bridge_msgs::srv::SubstituteBot::Response::SharedPtr response)
+    const std::shared_ptr<rmw_request_id_t> request_header,
+    const ssl_ros_bridge_msgs::srv::SubstituteBot::Request::SharedPtr /*request*/)
   {
-    if (!team_client_.IsConnected()) {
-      response->success = false;
-      response->reason = "Team client is not connected to the Game Controller.";
-      RCLCPP_ERROR(
-        get_logger(), "Service %s called before team client connected.",
-        substitute_bot_service_->get_service_name());
+    if (!CheckConnected(substitute_bot_service_, request_header)) {
       return;
     }
-    const auto result = team_client_.RequestBotSubstitution();
-    response->success = result.accepted;
-    response->reason = result.reason;
+    team_client_.RequestBotSubstitution(MakeResponder(substitute_bot_service_, request_header));
   }
 
   void HandleReconnectTeamClient(
-    const ssl_ros_bridge_msgs::srv::ReconnectTeamClient::Request::SharedPtr request,
-    ssl_ros_bridge_msgs::srv::ReconnectTeamClient::Response::SharedPtr response)
+    const std::shared_ptr<rmw_request_id_t> request_header,
+    const ssl_ros_bridge_msgs::srv::ReconnectTeamClient::Request::SharedPtr request)
   {
     if(!request->server_address.empty()) {
       set_parameter(rclcpp::Parameter("gc_ip_address", request->server_address));
     }
-    response->success = Connect();
+    Connect(
+      [this, request_header](bool connected) {
+        ssl_ros_bridge_msgs::srv::ReconnectTeamClient::Response response;
+        response.success = connected;
+        reconnect_service_->send_response(*request_header, response);
+      });
   }
 
   void HandleSetAdvantageChoice(
-    const ssl_ros_bridge_msgs::srv::SetTeamAdvantageChoice::Request::SharedPtr request,
-    ssl_ros_bridge_msgs::srv::SetTeamAdvantageChoice::Response::SharedPtr response)
+    const std::shared_ptr<rmw_request_id_t> request_header,
+    const ssl_ros_bridge_msgs::srv::SetTeamAdvantageChoice::Request::SharedPtr request)
   {
-    if (!team_client_.IsConnected()) {
-      response->success = false;
-      response->reason = "Team client is not connected to the Game Controller.";
-      RCLCPP_ERROR(
-        get_logger(), "Service %s called before team client connected.",
-        advantage_choice_service_->get_service_name());
+    if (!CheckConnected(advantage_choice_service_, request_header)) {
       return;
     }
     TeamClient::AdvantageChoiceOption choice;
@@ -184,25 +253,32 @@ private:
         choice = TeamClient::AdvantageChoiceOption::Continue;
         break;
     }
-    const auto result = team_client_.SetAdvantageChoice(choice);
-    response->success = result.accepted;
-    response->reason = result.reason;
+    team_client_.SetAdvantageChoice(
+      choice,
+      MakeResponder(advantage_choice_service_, request_header));
   }
 
   void PingCallback()
   {
-    ssl_ros_bridge_msgs::msg::TeamClientConnectionStatus status_msg;
-    status_msg.connected = team_client_.IsConnected();
-    if (team_client_.IsConnected()) {
-      const auto result = team_client_.Ping();
-      status_msg.connected = result.request_result.accepted;
-      status_msg.ping = rclcpp::Duration(result.ping);
-      if(!result.request_result.accepted) {
-        team_client_.Disconnect();
-        RCLCPP_WARN(get_logger(), "Ping failed. Team client disconnected.");
-      }
+    if (!team_client_.IsConnected()) {
+      ssl_ros_bridge_msgs::msg::TeamClientConnectionStatus status_msg;
+      status_msg.connected = false;
+      FillLinkStatistics(status_msg);
+      connection_status_publisher_->publish(status_msg);
+      return;
     }
-    connection_status_publisher_->publish(status_msg);
+    team_client_.Ping(
+      [this](const TeamClient::PingResult & result) {
+        ssl_ros_bridge_msgs::msg::TeamClientConnectionStatus status_msg;
+        status_msg.connected = result.request_result.accepted;
+        status_msg.ping = rclcpp::Duration(result.ping);
+        FillLinkStatistics(status_msg);
+        // Lost connections are restored by the team client itself
+        if(!result.request_result.accepted) {
+          RCLCPP_WARN(get_logger(), "Ping failed.");
+        }
+        connection_status_publisher_->publish(status_msg);
+      });
   }
 };
 }  // namespace ssl_ros_bridge::game_controller_bridge
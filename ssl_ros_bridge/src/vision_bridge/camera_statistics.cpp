@@ -0,0 +1,102 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "camera_statistics.hpp"
+
+#include <cmath>
+
+namespace ssl_ros_bridge::vision_bridge
+{
+
+namespace
+{
+constexpr double kIntervalBucketWidthMs = 1.0;
+constexpr std::size_t kIntervalBucketCount = 100;
+constexpr double kJitterBucketWidthMs = 0.5;
+constexpr std::size_t kJitterBucketCount = 100;
+constexpr double kLatencyBucketWidthMs = 1.0;
+constexpr std::size_t kLatencyBucketCount = 200;
+}  // namespace
+
+CameraStatistics::CameraStatistics()
+: interval_histogram_ms_(kIntervalBucketWidthMs, kIntervalBucketCount),
+  jitter_histogram_ms_(kJitterBucketWidthMs, kJitterBucketCount),
+  latency_histogram_ms_(kLatencyBucketWidthMs, kLatencyBucketCount)
+{
+}
+
+void CameraStatistics::AddFrame(
+  const uint32_t frame_number, const double capture_time,
+  const std::chrono::steady_clock::time_point arrival_time,
+  const std::chrono::system_clock::time_point publish_time)
+{
+  window_counts_.frames_received++;
+  total_counts_.frames_received++;
+
+  if (last_frame_number_) {
+    // Unsigned subtraction handles frame number wrap around
+    const auto frame_step = static_cast<int32_t>(frame_number - *last_frame_number_);
+    if (frame_step > 1) {
+      window_counts_.frames_dropped += frame_step - 1;
+      total_counts_.frames_dropped += frame_step - 1;
+    } else if (frame_step <= 0) {
+      // Duplicate, reordered, or ssl-vision restarted. Don't count these as losses.
+      window_counts_.frames_out_of_order++;
+      total_counts_.frames_out_of_order++;
+    }
+  }
+  last_frame_number_ = frame_number;
+
+  if (last_arrival_time_) {
+    const double interval_ms =
+      std::chrono::duration<double, std::milli>(arrival_time - *last_arrival_time_).count();
+    interval_histogram_ms_.AddSample(interval_ms);
+    if (last_interval_ms_) {
+      jitter_histogram_ms_.AddSample(std::abs(interval_ms - *last_interval_ms_));
+    }
+    last_interval_ms_ = interval_ms;
+  }
+  last_arrival_time_ = arrival_time;
+
+  const double publish_time_s =
+    std::chrono::duration<double>(publish_time.time_since_epoch()).count();
+  latency_histogram_ms_.AddSample((publish_time_s - capture_time) * 1e3);
+}
+
+void CameraStatistics::StartNewWindow()
+{
+  window_counts_.frames_received = 0;
+  window_counts_.frames_dropped = 0;
+  window_counts_.frames_out_of_order = 0;
+  interval_histogram_ms_.Reset();
+  jitter_histogram_ms_.Reset();
+  latency_histogram_ms_.Reset();
+}
+
+double CameraStatistics::GetWindowLossRatio() const
+{
+  const auto expected_frames = window_counts_.frames_received + window_counts_.frames_dropped;
+  if (expected_frames == 0) {
+    return 0.0;
+  }
+  return static_cast<double>(window_counts_.frames_dropped) / expected_frames;
+}
+
+}  // namespace ssl_ros_bridge::vision_bridge
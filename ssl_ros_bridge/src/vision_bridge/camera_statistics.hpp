@@ -0,0 +1,118 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef VISION_BRIDGE__CAMERA_STATISTICS_HPP_
+#define VISION_BRIDGE__CAMERA_STATISTICS_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+#include "core/histogram.hpp"
+
+namespace ssl_ros_bridge::vision_bridge
+{
+
+/**
+ * Tracks frame loss, inter-arrival timing, and latency for a single camera.
+ *
+ * Histograms cover the current reporting window and are cleared by StartNewWindow(). Frame
+ * counters are kept both for the window and for the lifetime of the object.
+ */
+class CameraStatistics
+{
+public:
+  struct Counts
+  {
+    uint64_t frames_received{0};
+    uint64_t frames_dropped{0};
+    uint64_t frames_out_of_order{0};
+  };
+
+  CameraStatistics();
+
+  /**
+   * @param frame_number Frame number reported by ssl-vision
+   * @param capture_time Unix timestamp in seconds at which ssl-vision captured the frame
+   * @param arrival_time Time at which the frame arrived at the bridge
+   * @param publish_time Wall clock time at which the frame was published into ROS
+   */
+  void AddFrame(
+    const uint32_t frame_number, const double capture_time,
+    const std::chrono::steady_clock::time_point arrival_time,
+    const std::chrono::system_clock::time_point publish_time);
+
+  void StartNewWindow();
+
+  /**
+   * Fraction of expected frames in the current window which never arrived.
+   */
+  double GetWindowLossRatio() const;
+
+  const Counts & GetWindowCounts() const
+  {
+    return window_counts_;
+  }
+
+  const Counts & GetTotalCounts() const
+  {
+    return total_counts_;
+  }
+
+  /**
+   * Time between consecutive frames, in milliseconds.
+   */
+  const core::Histogram & GetIntervalHistogram() const
+  {
+    return interval_histogram_ms_;
+  }
+
+  /**
+   * Absolute change between consecutive inter-arrival intervals, in milliseconds.
+   */
+  const core::Histogram & GetJitterHistogram() const
+  {
+    return jitter_histogram_ms_;
+  }
+
+  /**
+   * Time from capture in ssl-vision to publishing in ROS, in milliseconds.
+   *
+   * This includes any offset between the vision computer's clock and the local clock.
+   */
+  const core::Histogram & GetLatencyHistogram() const
+  {
+    return latency_histogram_ms_;
+  }
+
+private:
+  std::optional<uint32_t> last_frame_number_;
+  std::optional<std::chrono::steady_clock::time_point> last_arrival_time_;
+  std::optional<double> last_interval_ms_;
+  Counts window_counts_;
+  Counts total_counts_;
+  core::Histogram interval_histogram_ms_;
+  core::Histogram jitter_histogram_ms_;
+  core::Histogram latency_histogram_ms_;
+};
+
+}  // namespace ssl_ros_bridge::vision_bridge
+
+#endif  // VISION_BRIDGE__CAMERA_STATISTICS_HPP_
@@ -20,16 +20,30 @@
 
 #include <ssl_league_protobufs/ssl_vision_wrapper.pb.h>
 
+#include <chrono>
 #include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
 #include <string>
+#include <vector>
 
 #include <rclcpp/rclcpp.hpp>
 #include <rclcpp_components/register_node_macro.hpp>
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
+#include <tf2_msgs/msg/tf_message.hpp>
 
 #include "core/message_conversion.hpp"
 #include "core/multicast_receiver.hpp"
 #include "core/protobuf_logging.hpp"
+#include "core/stream_watchdog.hpp"
+#include "camera_statistics.hpp"
+#include "vision_filter.hpp"
+#include "vision_tf_builder.hpp"
 #include <ssl_league_msgs/msg/vision_wrapper.hpp>
+#include <ssl_ros_bridge_msgs/msg/stream_watchdog_status.hpp>
 
 namespace ssl_ros_bridge::vision_bridge
 {
@@ -41,7 +55,42 @@ public:
   : rclcpp::Node("ssl_vision_bridge", options),
     vision_publisher_(create_publisher<ssl_league_msgs::msg::VisionWrapper>("~/vision_messages",
       rclcpp::SystemDefaultsQoS())),
-    multicast_receiver_(
+    diagnostics_publisher_(create_publisher<diagnostic_msgs::msg::DiagnosticArray>("/diagnostics",
+      rclcpp::SystemDefaultsQoS())),
+    max_frame_loss_(declare_parameter<double>("diagnostics.max_frame_loss", 0.02)),
+    max_jitter_ms_(declare_parameter<double>("diagnostics.max_jitter_ms", 5.0)),
+    max_latency_ms_(declare_parameter<double>("diagnostics.max_latency_ms", 50.0))
+  {
+    SET_ROS_PROTOBUF_LOG_HANDLER("ssl_vision_bridge.protobuf");
+
+    declareOutputs();
+
+    const auto diagnostics_period = declare_parameter<double>("diagnostics.period", 1.0);
+    diagnostics_timer_ = create_wall_timer(
+      std::chrono::duration<double>(diagnostics_period),
+      std::bind(&SSLVisionBridgeNode::publishDiagnostics, this));
+
+    stream_status_publisher_ = create_publisher<ssl_ros_bridge_msgs::msg::StreamWatchdogStatus>(
+      "~/stream_status", rclcpp::QoS(1).transient_local());
+    watchdog_ = std::make_unique<core::StreamWatchdog>(
+      declare_parameter<double>("watchdog.missed_periods", 2.0),
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(declare_parameter<double>("watchdog.initial_period", 0.1))),
+      std::chrono::milliseconds(1),
+      std::bind(&SSLVisionBridgeNode::publishStreamStatus, this, std::placeholders::_1,
+      std::placeholders::_2));
+    // Zero derives the check period from the stale timeout
+    const auto watchdog_check_period = declare_parameter<double>("watchdog.check_period", 0.0);
+    watchdog_timer_ = create_wall_timer(
+      watchdog_check_period > 0.0 ?
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(watchdog_check_period)) :
+      watchdog_->GetCheckPeriod(),
+      [this]() {
+        watchdog_->Check();
+      });
+
+    multicast_receiver_ = std::make_unique<core::MulticastReceiver>(
       declare_parameter<std::string>("ssl_vision_ip", "224.5.23.2"),
       declare_parameter<int>("ssl_vision_port", 10020),
       std::bind(&SSLVisionBridgeNode::multicastCallback, this, std::placeholders::_3,
@@ -49,17 +98,125 @@ public:
       declare_parameter<std::string>("net_interface_address", ""),
       [this](const std::string & message) {
         RCLCPP_WARN(get_logger(), "%s", message.c_str());
-      })
-  {
-    SET_ROS_PROTOBUF_LOG_HANDLER("ssl_vision_bridge.protobuf");
+      });
   }
 
 private:
   rclcpp::Publisher<ssl_league_msgs::msg::VisionWrapper>::SharedPtr vision_publisher_;
-  core::MulticastReceiver multicast_receiver_;
+  rclcpp::Publisher<diagnostic_msgs::msg::DiagnosticArray>::SharedPtr diagnostics_publisher_;
+  rclcpp::TimerBase::SharedPtr diagnostics_timer_;
+  rclcpp::Publisher<ssl_ros_bridge_msgs::msg::StreamWatchdogStatus>::SharedPtr
+    stream_status_publisher_;
+  std::unique_ptr<core::StreamWatchdog> watchdog_;
+  rclcpp::TimerBase::SharedPtr watchdog_timer_;
+  const double max_frame_loss_;
+  const double max_jitter_ms_;
+  const double max_latency_ms_;
+  std::mutex camera_statistics_mutex_;
+  std::map<uint32_t, CameraStatistics> camera_statistics_;
+  std::map<uint32_t, uint8_t> camera_diagnostic_levels_;
+  bool per_camera_topics_{false};
+  std::map<uint32_t, rclcpp::Publisher<ssl_league_msgs::msg::VisionWrapper>::SharedPtr>
+    camera_publishers_;
+  std::chrono::steady_clock::duration decimated_period_{};
+  std::map<int64_t, std::chrono::steady_clock::time_point> last_decimated_publish_times_;
+  rclcpp::Publisher<ssl_league_msgs::msg::VisionWrapper>::SharedPtr decimated_publisher_;
+  VisionFilter filter_;
+  rclcpp::Publisher<ssl_league_msgs::msg::VisionWrapper>::SharedPtr filtered_publisher_;
+  std::optional<VisionTfBuilder> tf_builder_;
+  rclcpp::Publisher<tf2_msgs::msg::TFMessage>::SharedPtr tf_publisher_;
+  std::unique_ptr<core::MulticastReceiver> multicast_receiver_;
+
+  void declareOutputs()
+  {
+    per_camera_topics_ = declare_parameter<bool>("outputs.per_camera_topics", false);
+
+    const auto decimated_rate = declare_parameter<double>("outputs.decimated_rate", 0.0);
+    if (decimated_rate > 0.0) {
+      decimated_period_ = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(1.0 / decimated_rate));
+      decimated_publisher_ = create_publisher<ssl_league_msgs::msg::VisionWrapper>(
+        "~/vision_messages_decimated", rclcpp::SystemDefaultsQoS());
+    }
+
+    const auto filter_team = declare_parameter<std::string>("outputs.filtered.team", "");
+    const auto filter_robot_ids =
+      declare_parameter<std::vector<int64_t>>("outputs.filtered.robot_ids", std::vector<int64_t>{});
+    filter_.include_balls = declare_parameter<bool>("outputs.filtered.include_balls", true);
+    filter_.include_geometry = declare_parameter<bool>("outputs.filtered.include_geometry", true);
+    if (filter_team == "blue") {
+      filter_.team = VisionFilter::Team::Blue;
+    } else if (filter_team == "yellow") {
+      filter_.team = VisionFilter::Team::Yellow;
+    } else if (!filter_team.empty()) {
+      RCLCPP_WARN(
+        get_logger(), "Unrecognized filter team '%s'. Robots of both teams will be kept.",
+        filter_team.c_str());
+    }
+    filter_.robot_ids.assign(filter_robot_ids.begin(), filter_robot_ids.end());
+    if (!filter_team.empty() || !filter_robot_ids.empty() || !filter_.include_balls ||
+      !filter_.include_geometry)
+    {
+      filtered_publisher_ = create_publisher<ssl_league_msgs::msg::VisionWrapper>(
+        "~/vision_messages_filtered", rclcpp::SystemDefaultsQoS());
+    }
+
+    const auto tf_enable = declare_parameter<bool>("tf.enable", false);
+    const auto tf_frame_id = declare_parameter<std::string>("tf.frame_id", "field");
+    const auto tf_child_frame_prefix = declare_parameter<std::string>("tf.child_frame_prefix", "");
+    const auto tf_timeout = declare_parameter<double>("tf.timeout", 0.1);
+    if (tf_enable) {
+      tf_builder_.emplace(
+        tf_frame_id, tf_child_frame_prefix,
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::duration<double>(tf_timeout)));
+      // Matches the QoS used by tf2_ros::TransformBroadcaster
+      tf_publisher_ = create_publisher<tf2_msgs::msg::TFMessage>("/tf", rclcpp::QoS(100));
+    }
+  }
+
+  template<typename PublisherType>
+  static bool hasSubscribers(const std::shared_ptr<PublisherType> & publisher)
+  {
+    if (!publisher) {
+      return false;
+    }
+    const auto subscription_count = publisher->get_subscription_count() +
+      publisher->get_intra_process_subscription_count();
+    return subscription_count > 0;
+  }
+
+  rclcpp::Publisher<ssl_league_msgs::msg::VisionWrapper>::SharedPtr & getCameraPublisher(
+    const uint32_t camera_id)
+  {
+    auto & publisher = camera_publishers_[camera_id];
+    if (!publisher) {
+      publisher = create_publisher<ssl_league_msgs::msg::VisionWrapper>(
+        "~/camera_" + std::to_string(camera_id) + "/vision_messages",
+        rclcpp::SystemDefaultsQoS());
+    }
+    return publisher;
+  }
+
+  bool shouldPublishDecimated(
+    const SSL_WrapperPacket & vision_proto,
+    const std::chrono::steady_clock::time_point arrival_time)
+  {
+    // Each camera is decimated independently. Geometry-only packets share their own slot.
+    const int64_t key = vision_proto.has_detection() ? vision_proto.detection().camera_id() : -1;
+    const auto last_publish_time = last_decimated_publish_times_.find(key);
+    if (last_publish_time != last_decimated_publish_times_.end() &&
+      arrival_time - last_publish_time->second < decimated_period_)
+    {
+      return false;
+    }
+    last_decimated_publish_times_[key] = arrival_time;
+    return true;
+  }
 
   void multicastCallback(uint8_t * buffer, size_t bytes_received)
   {
+    const auto arrival_time = std::chrono::steady_clock::now();
     SSL_WrapperPacket vision_proto;
 
     if (!vision_proto.ParseFromArray(buffer, bytes_received)) {
@@ -67,7 +224,175 @@ private:
       return;
     }
 
-    vision_publisher_->publish(message_conversion::fromProto(vision_proto));
+    // Conversion is skipped entirely unless at least one output has a subscriber
+    std::optional<ssl_league_msgs::msg::VisionWrapper> vision_msg;
+    auto get_vision_msg = [&]() -> const ssl_league_msgs::msg::VisionWrapper & {
+        if (!vision_msg) {
+          vision_msg = message_conversion::fromProto(vision_proto);
+        }
+        return *vision_msg;
+      };
+
+    if (hasSubscribers(vision_publisher_)) {
+      vision_publisher_->publish(get_vision_msg());
+    }
+
+    if (per_camera_topics_ && vision_proto.has_detection()) {
+      const auto & camera_publisher = getCameraPublisher(vision_proto.detection().camera_id());
+      if (hasSubscribers(camera_publisher)) {
+        camera_publisher->publish(get_vision_msg());
+      }
+    }
+
+    if (hasSubscribers(decimated_publisher_) &&
+      shouldPublishDecimated(vision_proto, arrival_time))
+    {
+      decimated_publisher_->publish(get_vision_msg());
+    }
+
+    // Geometry-only packets would be empty once filtered, so they are not published at all
+    const auto has_filtered_content = vision_proto.has_detection() ||
+      (filter_.include_geometry && vision_proto.has_geometry());
+    if (has_filtered_content && hasSubscribers(filtered_publisher_)) {
+      filtered_publisher_->publish(FilterVisionMessage(get_vision_msg(), filter_));
+    }
+
+    if (tf_builder_ && vision_proto.has_detection() && hasSubscribers(tf_publisher_)) {
+      const auto & detection_msg = get_vision_msg().detection.front();
+      tf_publisher_->publish(tf_builder_->AddFrame(detection_msg, arrival_time));
+    }
+
+    if (vision_proto.has_detection()) {
+      const auto & detection = vision_proto.detection();
+      watchdog_->NotifyReceived("camera_" + std::to_string(detection.camera_id()), arrival_time);
+      std::lock_guard lock(camera_statistics_mutex_);
+      camera_statistics_[detection.camera_id()].AddFrame(
+        detection.frame_number(), detection.t_capture(), arrival_time,
+        std::chrono::system_clock::now());
+    }
+  }
+
+  void publishStreamStatus(
+    const core::StreamWatchdog::StreamState & changed_stream,
+    const std::vector<core::StreamWatchdog::StreamState> & states)
+  {
+    if (changed_stream.stale) {
+      RCLCPP_WARN(get_logger(), "Vision stream %s is stale.", changed_stream.name.c_str());
+    } else {
+      RCLCPP_INFO(get_logger(), "Vision stream %s is active.", changed_stream.name.c_str());
+    }
+    stream_status_publisher_->publish(core::StreamWatchdog::ToMsg(states, now()));
+  }
+
+  void publishDiagnostics()
+  {
+    diagnostic_msgs::msg::DiagnosticArray diagnostics_msg;
+    diagnostics_msg.header.stamp = now();
+    {
+      std::lock_guard lock(camera_statistics_mutex_);
+      for (auto & [camera_id, statistics] : camera_statistics_) {
+        diagnostics_msg.status.push_back(makeCameraStatus(camera_id, statistics));
+        statistics.StartNewWindow();
+      }
+    }
+    diagnostics_publisher_->publish(diagnostics_msg);
+  }
+
+  diagnostic_msgs::msg::DiagnosticStatus makeCameraStatus(
+    const uint32_t camera_id,
+    const CameraStatistics & statistics)
+  {
+    using diagnostic_msgs::msg::DiagnosticStatus;
+    DiagnosticStatus status;
+    status.name = std::string(get_name()) + ": camera " + std::to_string(camera_id);
+    status.hardware_id = "ssl_vision_camera_" + std::to_string(camera_id);
+
+    const auto & window_counts = statistics.GetWindowCounts();
+    const auto & total_counts = statistics.GetTotalCounts();
+    const auto loss_ratio = statistics.GetWindowLossRatio();
+    const auto & intervals = statistics.GetIntervalHistogram();
+    const auto & jitter = statistics.GetJitterHistogram();
+    const auto & latency = statistics.GetLatencyHistogram();
+
+    std::vector<std::string> problems;
+    if (window_counts.frames_received == 0) {
+      problems.push_back("No frames received");
+    }
+    if (loss_ratio > max_frame_loss_) {
+      problems.push_back("Frame loss " + formatDouble(loss_ratio * 100.0) + "%");
+    }
+    if (jitter.GetPercentile(0.95) > max_jitter_ms_) {
+      problems.push_back("Jitter " + formatDouble(jitter.GetPercentile(0.95)) + " ms");
+    }
+    if (latency.GetPercentile(0.95) > max_latency_ms_) {
+      problems.push_back("Latency " + formatDouble(latency.GetPercentile(0.95)) + " ms");
+    }
+
+    if (problems.empty()) {
+      status.level = DiagnosticStatus::OK;
+      status.message = "OK";
+    } else {
+      status.level = DiagnosticStatus::WARN;
+      std::ostringstream message;
+      for (std::size_t i = 0; i < problems.size(); ++i) {
+        message << (i == 0 ? "" : ", ") << problems[i];
+      }
+      status.message = message.str();
+    }
+
+    auto & previous_level = camera_diagnostic_levels_[camera_id];
+    if (status.level != previous_level) {
+      if (status.level == DiagnosticStatus::OK) {
+        RCLCPP_INFO(get_logger(), "Camera %u recovered.", camera_id);
+      } else {
+        RCLCPP_WARN(get_logger(), "Camera %u degraded: %s", camera_id, status.message.c_str());
+      }
+      previous_level = status.level;
+    }
+
+    auto add_value = [&status](const std::string & key, const std::string & value) {
+        diagnostic_msgs::msg::KeyValue key_value;
+        key_value.key = key;
+        key_value.value = value;
+        status.values.push_back(key_value);
+      };
+    add_value("frames_received", std::to_string(window_counts.frames_received));
+    add_value("frames_dropped", std::to_string(window_counts.frames_dropped));
+    add_value("frames_out_of_order", std::to_string(window_counts.frames_out_of_order));
+    add_value("frame_loss_percent", formatDouble(loss_ratio * 100.0));
+    add_value("total_frames_received", std::to_string(total_counts.frames_received));
+    add_value("total_frames_dropped", std::to_string(total_counts.frames_dropped));
+    addHistogramValues("interval_ms", intervals, add_value);
+    addHistogramValues("jitter_ms", jitter, add_value);
+    addHistogramValues("latency_ms", latency, add_value);
+    return status;
+  }
+
+  template<typename AddValueFunction>
+  static void addHistogramValues(
+    const std::string & prefix, const core::Histogram & histogram,
+    AddValueFunction & add_value)
+  {
+    add_value(prefix + ".mean", formatDouble(histogram.GetMean()));
+    add_value(prefix + ".p50", formatDouble(histogram.GetPercentile(0.5)));
+    add_value(prefix + ".p95", formatDouble(histogram.GetPercentile(0.95)));
+    add_value(prefix + ".max", formatDouble(histogram.GetMax()));
+    std::ostringstream buckets;
+    const auto & bucket_counts = histogram.GetBucketCounts();
+    for (std::size_t i = 0; i < bucket_counts.size(); ++i) {
+      buckets << (i == 0 ? "" : ",") << bucket_counts[i];
+    }
+    add_value(prefix + ".bucket_width", formatDouble(histogram.GetBucketWidth()));
+    add_value(prefix + ".buckets", buckets.str());
+  }
+
+  static std::string formatDouble(const double value)
+  {
+    std::ostringstream stream;
+    stream.setf(std::ios::fixed);
+    stream.precision(2);
+    stream << value;
+    return stream.str();
   }
 };
 
@@ -0,0 +1,76 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "vision_filter.hpp"
+
+#include <algorithm>
+
+namespace ssl_ros_bridge::vision_bridge
+{
+
+namespace
+{
+
+void FilterRobots(
+  std::vector<ssl_league_msgs::msg::VisionDetectionRobot> & robots,
+  const std::vector<uint32_t> & robot_ids)
+{
+  if (robot_ids.empty()) {
+    return;
+  }
+  std::erase_if(
+    robots, [&robot_ids](const auto & robot) {
+      return std::ranges::find(robot_ids, robot.robot_id) == robot_ids.end();
+    });
+}
+
+}  // namespace
+
+ssl_league_msgs::msg::VisionWrapper FilterVisionMessage(
+  const ssl_league_msgs::msg::VisionWrapper & message,
+  const VisionFilter & filter)
+{
+  ssl_league_msgs::msg::VisionWrapper filtered_message;
+  if (filter.include_geometry) {
+    filtered_message.geometry = message.geometry;
+  }
+  for (const auto & detection : message.detection) {
+    auto & filtered_detection = filtered_message.detection.emplace_back();
+    filtered_detection.frame_number = detection.frame_number;
+    filtered_detection.t_capture = detection.t_capture;
+    filtered_detection.t_sent = detection.t_sent;
+    filtered_detection.t_capture_camera = detection.t_capture_camera;
+    filtered_detection.camera_id = detection.camera_id;
+    if (filter.include_balls) {
+      filtered_detection.balls = detection.balls;
+    }
+    if (filter.team != VisionFilter::Team::Yellow) {
+      filtered_detection.robots_blue = detection.robots_blue;
+      FilterRobots(filtered_detection.robots_blue, filter.robot_ids);
+    }
+    if (filter.team != VisionFilter::Team::Blue) {
+      filtered_detection.robots_yellow = detection.robots_yellow;
+      FilterRobots(filtered_detection.robots_yellow, filter.robot_ids);
+    }
+  }
+  return filtered_message;
+}
+
+}  // namespace ssl_ros_bridge::vision_bridge
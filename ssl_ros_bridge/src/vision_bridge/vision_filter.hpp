@@ -0,0 +1,57 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef VISION_BRIDGE__VISION_FILTER_HPP_
+#define VISION_BRIDGE__VISION_FILTER_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include <ssl_league_msgs/msg/vision_wrapper.hpp>
+
+namespace ssl_ros_bridge::vision_bridge
+{
+
+struct VisionFilter
+{
+  enum class Team
+  {
+    Any,
+    Blue,
+    Yellow
+  };
+
+  Team team{Team::Any};
+  /// Only robots with these IDs are kept. Empty keeps all robots.
+  std::vector<uint32_t> robot_ids;
+  bool include_balls{true};
+  bool include_geometry{true};
+};
+
+/**
+ * Returns a copy of the given message with only the detections and geometry allowed by the filter.
+ */
+ssl_league_msgs::msg::VisionWrapper FilterVisionMessage(
+  const ssl_league_msgs::msg::VisionWrapper & message,
+  const VisionFilter & filter);
+
+}  // namespace ssl_ros_bridge::vision_bridge
+
+#endif  // VISION_BRIDGE__VISION_FILTER_HPP_
@@ -0,0 +1,163 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "vision_tf_builder.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace ssl_ros_bridge::vision_bridge
+{
+
+VisionTfBuilder::VisionTfBuilder(
+  const std::string & frame_id, const std::string & child_frame_prefix,
+  const std::chrono::steady_clock::duration timeout)
+: timeout_(timeout)
+{
+  auto init_slot = [&](ObjectSlot & slot, const std::string & name) {
+      slot.transform.header.frame_id = frame_id;
+      slot.transform.child_frame_id = child_frame_prefix + name;
+    };
+  for (std::size_t id = 0; id < kMaxRobotsPerTeam; ++id) {
+    init_slot(blue_robot_slots_[id], "blue_robot_" + std::to_string(id));
+    init_slot(yellow_robot_slots_[id], "yellow_robot_" + std::to_string(id));
+  }
+  init_slot(ball_slot_, "ball");
+
+  // Preallocate a transform, including its frame name strings, for every possible object. They
+  // start out as spares and move into the output message as objects appear.
+  constexpr auto kMaxTransforms = (2 * kMaxRobotsPerTeam) + 1;
+  tf_message_.transforms.reserve(kMaxTransforms);
+  spare_transforms_.reserve(kMaxTransforms);
+  std::ranges::for_each(
+    blue_robot_slots_, [this](const auto & slot) {
+      spare_transforms_.push_back(slot.transform);
+    });
+  std::ranges::for_each(
+    yellow_robot_slots_, [this](const auto & slot) {
+      spare_transforms_.push_back(slot.transform);
+    });
+  spare_transforms_.push_back(ball_slot_.transform);
+}
+
+const tf2_msgs::msg::TFMessage & VisionTfBuilder::AddFrame(
+  const ssl_league_msgs::msg::VisionDetectionFrame & frame,
+  const std::chrono::steady_clock::time_point arrival_time)
+{
+  UpdateRobots(blue_robot_slots_, frame.robots_blue, frame, arrival_time);
+  UpdateRobots(yellow_robot_slots_, frame.robots_yellow, frame, arrival_time);
+  UpdateBall(frame, arrival_time);
+
+  std::size_t transform_count = 0;
+  for (const auto & slot : blue_robot_slots_) {
+    AppendIfCurrent(slot, arrival_time, transform_count);
+  }
+  for (const auto & slot : yellow_robot_slots_) {
+    AppendIfCurrent(slot, arrival_time, transform_count);
+  }
+  AppendIfCurrent(ball_slot_, arrival_time, transform_count);
+  // Transforms of objects which are gone go back to the spares with their string buffers
+  auto & transforms = tf_message_.transforms;
+  while (transforms.size() > transform_count) {
+    spare_transforms_.push_back(std::move(transforms.back()));
+    transforms.pop_back();
+  }
+  return tf_message_;
+}
+
+bool VisionTfBuilder::ShouldReplace(
+  const ObjectSlot & slot, const float confidence, const uint32_t camera_id,
+  const std::chrono::steady_clock::time_point arrival_time) const
+{
+  return !slot.valid ||
+         slot.camera_id == camera_id ||
+         confidence >= slot.confidence ||
+         (arrival_time - slot.update_time) > timeout_;
+}
+
+void VisionTfBuilder::UpdateRobots(
+  std::array<ObjectSlot, kMaxRobotsPerTeam> & slots,
+  const std::vector<ssl_league_msgs::msg::VisionDetectionRobot> & robots,
+  const ssl_league_msgs::msg::VisionDetectionFrame & frame,
+  const std::chrono::steady_clock::time_point arrival_time)
+{
+  for (const auto & robot : robots) {
+    if (robot.robot_id >= kMaxRobotsPerTeam) {
+      continue;
+    }
+    auto & slot = slots[robot.robot_id];
+    if (!ShouldReplace(slot, robot.confidence, frame.camera_id, arrival_time)) {
+      continue;
+    }
+    slot.valid = true;
+    slot.confidence = robot.confidence;
+    slot.camera_id = frame.camera_id;
+    slot.update_time = arrival_time;
+    slot.transform.header.stamp = frame.t_capture;
+    slot.transform.transform.translation.x = robot.pose.position.x;
+    slot.transform.transform.translation.y = robot.pose.position.y;
+    slot.transform.transform.translation.z = robot.pose.position.z;
+    // Orientation was already computed by message_conversion::fromProto
+    slot.transform.transform.rotation = robot.pose.orientation;
+  }
+}
+
+void VisionTfBuilder::UpdateBall(
+  const ssl_league_msgs::msg::VisionDetectionFrame & frame,
+  const std::chrono::steady_clock::time_point arrival_time)
+{
+  const auto best_ball = std::ranges::max_element(
+    frame.balls, {}, [](const auto & ball) {
+      return ball.confidence;
+    });
+  if (best_ball == frame.balls.end()) {
+    return;
+  }
+  if (!ShouldReplace(ball_slot_, best_ball->confidence, frame.camera_id, arrival_time)) {
+    return;
+  }
+  ball_slot_.valid = true;
+  ball_slot_.confidence = best_ball->confidence;
+  ball_slot_.camera_id = frame.camera_id;
+  ball_slot_.update_time = arrival_time;
+  ball_slot_.transform.header.stamp = frame.t_capture;
+  ball_slot_.transform.transform.translation.x = best_ball->pos.x;
+  ball_slot_.transform.transform.translation.y = best_ball->pos.y;
+  ball_slot_.transform.transform.translation.z = best_ball->pos.z;
+}
+
+void VisionTfBuilder::AppendIfCurrent(
+  const ObjectSlot & slot, const std::chrono::steady_clock::time_point now,
+  std::size_t & transform_count)
+{
+  if (!slot.valid || (now - slot.update_time) > timeout_) {
+    return;
+  }
+  auto & transforms = tf_message_.transforms;
+  if (transform_count == transforms.size()) {
+    transforms.push_back(std::move(spare_transforms_.back()));
+    spare_transforms_.pop_back();
+  }
+  // Assigning into an existing transform reuses its strings' buffers
+  transforms[transform_count] = slot.transform;
+  transform_count++;
+}
+
+}  // namespace ssl_ros_bridge::vision_bridge
@@ -0,0 +1,107 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef VISION_BRIDGE__VISION_TF_BUILDER_HPP_
+#define VISION_BRIDGE__VISION_TF_BUILDER_HPP_
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <geometry_msgs/msg/transform_stamped.hpp>
+#include <ssl_league_msgs/msg/vision_detection_frame.hpp>
+#include <tf2_msgs/msg/tf_message.hpp>
+
+namespace ssl_ros_bridge::vision_bridge
+{
+
+/**
+ * Merges detections from all cameras into a single TF message holding every robot and the ball.
+ *
+ * Each object keeps the detection from the most confident camera which has seen it within the
+ * timeout. Transforms are allocated at construction and overwritten in place by every call to
+ * AddFrame(), so steady operation does not allocate or free memory.
+ */
+class VisionTfBuilder
+{
+public:
+  static constexpr std::size_t kMaxRobotsPerTeam = 16;
+
+  /**
+   * @param frame_id Parent frame of all transforms
+   * @param child_frame_prefix Prepended to the child frame names ("blue_robot_<id>",
+   * "yellow_robot_<id>", and "ball")
+   * @param timeout Objects not seen by any camera for this long are dropped
+   */
+  VisionTfBuilder(
+    const std::string & frame_id, const std::string & child_frame_prefix,
+    const std::chrono::steady_clock::duration timeout);
+
+  /**
+   * Merges the detections of one camera frame and returns the TF message for all tracked objects.
+   *
+   * The returned reference remains valid until the next call.
+   */
+  const tf2_msgs::msg::TFMessage & AddFrame(
+    const ssl_league_msgs::msg::VisionDetectionFrame & frame,
+    const std::chrono::steady_clock::time_point arrival_time);
+
+private:
+  struct ObjectSlot
+  {
+    bool valid{false};
+    float confidence{0.0f};
+    uint32_t camera_id{0};
+    std::chrono::steady_clock::time_point update_time;
+    geometry_msgs::msg::TransformStamped transform;
+  };
+
+  std::chrono::steady_clock::duration timeout_;
+  std::array<ObjectSlot, kMaxRobotsPerTeam> blue_robot_slots_;
+  std::array<ObjectSlot, kMaxRobotsPerTeam> yellow_robot_slots_;
+  ObjectSlot ball_slot_;
+  tf2_msgs::msg::TFMessage tf_message_;
+  // Preallocated transforms not currently in tf_message_
+  std::vector<geometry_msgs::msg::TransformStamped> spare_transforms_;
+
+  bool ShouldReplace(
+    const ObjectSlot & slot, const float confidence, const uint32_t camera_id,
+    const std::chrono::steady_clock::time_point arrival_time) const;
+
+  void UpdateRobots(
+    std::array<ObjectSlot, kMaxRobotsPerTeam> & slots,
+    const std::vector<ssl_league_msgs::msg::VisionDetectionRobot> & robots,
+    const ssl_league_msgs::msg::VisionDetectionFrame & frame,
+    const std::chrono::steady_clock::time_point arrival_time);
+
+  void UpdateBall(
+    const ssl_league_msgs::msg::VisionDetectionFrame & frame,
+    const std::chrono::steady_clock::time_point arrival_time);
+
+  void AppendIfCurrent(
+    const ObjectSlot & slot, const std::chrono::steady_clock::time_point now,
+    std::size_t & transform_count);
+};
+
+}  // namespace ssl_ros_bridge::vision_bridge
+
+#endif  // VISION_BRIDGE__VISION_TF_BUILDER_HPP_
@@ -0,0 +1,175 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <ssl_league_protobufs/ssl_gc_rcon_team.pb.h>
+#include <google/protobuf/util/delimited_message_util.h>
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "team_client/delimited_message_decoder.hpp"
+
+namespace
+{
+
+using ssl_ros_bridge::game_controller_bridge::DelimitedMessageDecoder;
+using Status = DelimitedMessageDecoder::Status;
+
+void Write(DelimitedMessageDecoder & decoder, const std::string & bytes)
+{
+  auto buffer = decoder.PrepareWrite(bytes.size());
+  std::memcpy(buffer.data(), bytes.data(), bytes.size());
+  decoder.CommitWrite(bytes.size());
+}
+
+std::string Delimit(const google::protobuf::MessageLite & message)
+{
+  std::ostringstream stream;
+  google::protobuf::util::SerializeDelimitedToOstream(message, &stream);
+  return stream.str();
+}
+
+ControllerToTeam MakeReply(const std::string & reason)
+{
+  ControllerToTeam message;
+  message.mutable_controller_reply()->set_status_code(ControllerReply::OK);
+  message.mutable_controller_reply()->set_reason(reason);
+  return message;
+}
+
+TEST(DelimitedMessageDecoderTest, DecodesStreamSplitAtRandomPoints)
+{
+  std::mt19937 random_engine(42);
+  // Sizes cross the initial capacity and need two byte length prefixes
+  std::uniform_int_distribution<std::size_t> reason_size_distribution(0, 400);
+  std::vector<std::string> reasons;
+  std::string stream;
+  for(int i = 0; i < 500; ++i) {
+    reasons.push_back(std::string(reason_size_distribution(random_engine), 'a' + i % 26));
+    stream += Delimit(MakeReply(reasons.back()));
+  }
+
+  for(const std::size_t max_chunk_size : {1, 7, 64, 1500}) {
+    DelimitedMessageDecoder decoder(8);
+    std::uniform_int_distribution<std::size_t> chunk_size_distribution(1, max_chunk_size);
+    std::size_t offset = 0;
+    std::size_t decoded_count = 0;
+    while(offset < stream.size()) {
+      const auto chunk_size =
+        std::min(chunk_size_distribution(random_engine), stream.size() - offset);
+      Write(decoder, stream.substr(offset, chunk_size));
+      offset += chunk_size;
+      ControllerToTeam message;
+      Status status;
+      while((status = decoder.Next(message)) == Status::Complete) {
+        ASSERT_LT(decoded_count, reasons.size());
+        EXPECT_EQ(message.controller_reply().reason(), reasons[decoded_count]);
+        decoded_count++;
+      }
+      ASSERT_EQ(status, Status::Incomplete);
+    }
+    EXPECT_EQ(decoded_count, reasons.size()) << "max chunk size " << max_chunk_size;
+    EXPECT_EQ(decoder.GetBufferedSize(), 0u);
+  }
+}
+
+TEST(DelimitedMessageDecoderTest, DecodesZeroLengthFrames)
+{
+  DelimitedMessageDecoder decoder;
+  Write(decoder, std::string(1, '\0') + Delimit(MakeReply("after")) + std::string(1, '\0'));
+
+  ControllerToTeam message = MakeReply("stale");
+  ASSERT_EQ(decoder.Next(message), Status::Complete);
+  EXPECT_FALSE(message.has_controller_reply());
+  ASSERT_EQ(decoder.Next(message), Status::Complete);
+  EXPECT_EQ(message.controller_reply().reason(), "after");
+  ASSERT_EQ(decoder.Next(message), Status::Complete);
+  EXPECT_FALSE(message.has_controller_reply());
+  EXPECT_EQ(decoder.Next(message), Status::Incomplete);
+}
+
+TEST(DelimitedMessageDecoderTest, WaitsForTruncatedFrames)
+{
+  const auto frame = Delimit(MakeReply(std::string(200, 'x')));
+  DelimitedMessageDecoder decoder;
+  ControllerToTeam message;
+
+  // First byte of the two byte length prefix
+  Write(decoder, frame.substr(0, 1));
+  EXPECT_EQ(decoder.Next(message), Status::Incomplete);
+  Write(decoder, frame.substr(1, 100));
+  EXPECT_EQ(decoder.Next(message), Status::Incomplete);
+  EXPECT_EQ(decoder.GetBufferedSize(), 101u);
+  Write(decoder, frame.substr(101));
+  ASSERT_EQ(decoder.Next(message), Status::Complete);
+  EXPECT_EQ(message.controller_reply().reason(), std::string(200, 'x'));
+  EXPECT_EQ(decoder.GetBufferedSize(), 0u);
+}
+
+TEST(DelimitedMessageDecoderTest, RejectsOversizeLength)
+{
+  DelimitedMessageDecoder decoder(1024, 16);
+  ControllerToTeam message;
+
+  Write(decoder, Delimit(MakeReply(std::string(8, 'x'))));
+  ASSERT_EQ(decoder.Next(message), Status::Complete);
+
+  // The length alone is enough to reject the frame, before any payload arrives
+  Write(decoder, std::string(1, '\x11'));
+  EXPECT_EQ(decoder.Next(message), Status::Error);
+  EXPECT_EQ(decoder.GetBufferedSize(), 0u);
+
+  Write(decoder, Delimit(MakeReply("ok")));
+  ASSERT_EQ(decoder.Next(message), Status::Complete);
+  EXPECT_EQ(message.controller_reply().reason(), "ok");
+}
+
+TEST(DelimitedMessageDecoderTest, RejectsOverlongVarint)
+{
+  DelimitedMessageDecoder decoder;
+  ControllerToTeam message;
+
+  // Four continuation bytes could still be a valid 32 bit length
+  Write(decoder, std::string(4, '\x80'));
+  EXPECT_EQ(decoder.Next(message), Status::Incomplete);
+  Write(decoder, std::string(1, '\x80'));
+  EXPECT_EQ(decoder.Next(message), Status::Error);
+  EXPECT_EQ(decoder.GetBufferedSize(), 0u);
+
+  Write(decoder, Delimit(MakeReply("ok")));
+  ASSERT_EQ(decoder.Next(message), Status::Complete);
+  EXPECT_EQ(message.controller_reply().reason(), "ok");
+}
+
+TEST(DelimitedMessageDecoderTest, SkipsUnparsableFrame)
+{
+  DelimitedMessageDecoder decoder;
+  ControllerToTeam message;
+
+  Write(decoder, std::string("\x02\xff\xff", 3) + Delimit(MakeReply("next")));
+  EXPECT_EQ(decoder.Next(message), Status::Error);
+  ASSERT_EQ(decoder.Next(message), Status::Complete);
+  EXPECT_EQ(message.controller_reply().reason(), "next");
+}
+
+}  // namespace
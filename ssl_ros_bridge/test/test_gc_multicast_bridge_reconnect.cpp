@@ -0,0 +1,175 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <boost/asio.hpp>
+#include <class_loader/class_loader.hpp>
+#include <rclcpp/rclcpp.hpp>
+#include <rclcpp_components/node_factory.hpp>
+#include <ssl_league_msgs/msg/referee.hpp>
+#include <ssl_league_protobufs/ssl_gc_referee_message.pb.h>
+#include <ssl_ros_bridge_msgs/srv/reconnect_team_client.hpp>
+
+namespace
+{
+
+using namespace std::chrono_literals;
+
+const auto kSendPeriod = 10ms;
+// Long enough for the bridge to time out on the stalled service and try again
+const auto kSendDuration = 4500ms;
+const auto kMaxPublishGap = 100ms;
+
+uint16_t FindFreeUdpPort()
+{
+  boost::asio::io_context io_context;
+  boost::asio::ip::udp::socket socket(io_context,
+    boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+  return socket.local_endpoint().port();
+}
+
+void FillTeamInfo(Referee::TeamInfo & team, const std::string & name)
+{
+  team.set_name(name);
+  team.set_score(0);
+  team.set_red_cards(0);
+  team.set_yellow_cards(0);
+  team.set_timeouts(4);
+  team.set_timeout_time(300'000'000);
+  team.set_goalkeeper(0);
+}
+
+std::string MakeRefereePacket(const uint64_t timestamp)
+{
+  Referee referee;
+  referee.set_packet_timestamp(timestamp);
+  referee.set_stage(Referee::NORMAL_FIRST_HALF);
+  referee.set_command(Referee::HALT);
+  referee.set_command_counter(1);
+  referee.set_command_timestamp(0);
+  FillTeamInfo(*referee.mutable_yellow(), "yellow");
+  FillTeamInfo(*referee.mutable_blue(), "blue");
+  return referee.SerializeAsString();
+}
+
+class GCMulticastBridgeReconnectTest : public ::testing::Test
+{
+protected:
+  static void SetUpTestSuite()
+  {
+    rclcpp::init(0, nullptr);
+  }
+
+  static void TearDownTestSuite()
+  {
+    rclcpp::shutdown();
+  }
+};
+
+TEST_F(GCMulticastBridgeReconnectTest, StalledTeamClientDoesNotDelayRefereeMessages)
+{
+  const auto port = FindFreeUdpPort();
+
+  class_loader::ClassLoader loader(GC_BRIDGE_LIBRARY);
+  auto node_factory = loader.createInstance<rclcpp_components::NodeFactory>(
+    "rclcpp_components::NodeFactoryTemplate<"
+    "ssl_ros_bridge::game_controller_bridge::GCMulticastBridgeNode>");
+  rclcpp::NodeOptions bridge_options;
+  bridge_options.parameter_overrides({
+      {"multicast.address", "127.0.0.1"},
+      {"multicast.port", static_cast<int>(port)},
+    });
+  auto bridge_node = node_factory->create_node_instance(bridge_options);
+
+  auto test_node = std::make_shared<rclcpp::Node>("gc_bridge_reconnect_test");
+
+  // Accept reconnect requests but never answer them, like a team client stuck connecting
+  using ReconnectTeamClient = ssl_ros_bridge_msgs::srv::ReconnectTeamClient;
+  std::atomic_int reconnect_request_count{0};
+  auto reconnect_service = test_node->create_service<ReconnectTeamClient>(
+    "/team_client_node/reconnect",
+    [&reconnect_request_count](const std::shared_ptr<rmw_request_id_t>,
+    const ReconnectTeamClient::Request::SharedPtr) {
+      reconnect_request_count++;
+    });
+
+  std::mutex receive_times_mutex;
+  std::vector<std::chrono::steady_clock::time_point> receive_times;
+  auto referee_subscription = test_node->create_subscription<ssl_league_msgs::msg::Referee>(
+    "/gc_multicast_bridge/referee_messages", rclcpp::SystemDefaultsQoS(),
+    [&](const ssl_league_msgs::msg::Referee::ConstSharedPtr) {
+      std::lock_guard lock(receive_times_mutex);
+      receive_times.push_back(std::chrono::steady_clock::now());
+    });
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(bridge_node.get_node_base_interface());
+  executor.add_node(test_node);
+  std::thread spin_thread([&executor]() {executor.spin();});
+
+  const auto discovery_deadline = std::chrono::steady_clock::now() + 10s;
+  while(referee_subscription->get_publisher_count() == 0 &&
+    std::chrono::steady_clock::now() < discovery_deadline)
+  {
+    std::this_thread::sleep_for(10ms);
+  }
+  ASSERT_GT(referee_subscription->get_publisher_count(), 0u);
+
+  boost::asio::io_context io_context;
+  boost::asio::ip::udp::socket socket(io_context, boost::asio::ip::udp::v4());
+  const boost::asio::ip::udp::endpoint bridge_endpoint(
+    boost::asio::ip::address_v4::loopback(), port);
+  const auto send_start = std::chrono::steady_clock::now();
+  auto next_send_time = send_start;
+  uint64_t timestamp = 1'000'000;
+  int sent_count = 0;
+  while(next_send_time - send_start < kSendDuration) {
+    std::this_thread::sleep_until(next_send_time);
+    socket.send_to(boost::asio::buffer(MakeRefereePacket(timestamp)), bridge_endpoint);
+    timestamp += std::chrono::duration_cast<std::chrono::microseconds>(kSendPeriod).count();
+    next_send_time += kSendPeriod;
+    sent_count++;
+  }
+  std::this_thread::sleep_for(200ms);
+
+  executor.cancel();
+  spin_thread.join();
+
+  // The first request times out after two seconds, so a second one proves the timeout path ran
+  EXPECT_GE(reconnect_request_count.load(), 2);
+
+  std::lock_guard lock(receive_times_mutex);
+  ASSERT_GE(receive_times.size(), static_cast<std::size_t>(sent_count * 9 / 10));
+  std::chrono::steady_clock::duration max_gap{0};
+  for(std::size_t i = 1; i < receive_times.size(); ++i) {
+    max_gap = std::max(max_gap, receive_times[i] - receive_times[i - 1]);
+  }
+  EXPECT_LT(max_gap, kMaxPublishGap);
+}
+
+}  // namespace
@@ -0,0 +1,114 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <random>
+#include "core/histogram.hpp"
+
+namespace
+{
+
+using ssl_ros_bridge::core::Histogram;
+
+constexpr double kBucketWidth = 0.5;
+constexpr std::size_t kBucketCount = 100;
+
+void ExpectSameHistogram(const Histogram & actual, const Histogram & expected)
+{
+  EXPECT_EQ(actual.GetBucketCounts(), expected.GetBucketCounts());
+  EXPECT_EQ(actual.GetSampleCount(), expected.GetSampleCount());
+  // Sums are added in a different order, so the mean may differ in the last bits
+  EXPECT_NEAR(actual.GetMean(), expected.GetMean(), 1e-9);
+  EXPECT_EQ(actual.GetMin(), expected.GetMin());
+  EXPECT_EQ(actual.GetMax(), expected.GetMax());
+  for(const auto fraction : {0.0, 0.1, 0.5, 0.9, 0.99, 1.0}) {
+    EXPECT_EQ(actual.GetPercentile(fraction), expected.GetPercentile(fraction)) << fraction;
+  }
+}
+
+TEST(HistogramTest, MergeMatchesAddingAllSamples)
+{
+  std::mt19937 random_engine(7);
+  // Some samples land in the overflow bucket
+  std::uniform_real_distribution<double> distribution(0.0, 60.0);
+  Histogram first(kBucketWidth, kBucketCount);
+  Histogram second(kBucketWidth, kBucketCount);
+  Histogram combined(kBucketWidth, kBucketCount);
+  for(int i = 0; i < 1000; ++i) {
+    const auto value = distribution(random_engine);
+    (i % 3 == 0 ? first : second).AddSample(value);
+    combined.AddSample(value);
+  }
+
+  first.Merge(second);
+  ExpectSameHistogram(first, combined);
+  EXPECT_GT(first.GetBucketCounts().back(), 0u);
+}
+
+TEST(HistogramTest, MergeIntoEmptyCopiesRange)
+{
+  Histogram empty(kBucketWidth, kBucketCount);
+  Histogram other(kBucketWidth, kBucketCount);
+  other.AddSample(3.0);
+  other.AddSample(7.0);
+
+  // An empty histogram's zero min and max must not leak into the result
+  empty.Merge(other);
+  ExpectSameHistogram(empty, other);
+  EXPECT_EQ(empty.GetMin(), 3.0);
+  EXPECT_EQ(empty.GetMax(), 7.0);
+}
+
+TEST(HistogramTest, MergeEmptyChangesNothing)
+{
+  Histogram histogram(kBucketWidth, kBucketCount);
+  histogram.AddSample(12.0);
+  histogram.AddSample(20.0);
+  Histogram expected = histogram;
+
+  histogram.Merge(Histogram(kBucketWidth, kBucketCount));
+  ExpectSameHistogram(histogram, expected);
+}
+
+TEST(HistogramTest, ResetAfterMergeClearsSamples)
+{
+  Histogram histogram(kBucketWidth, kBucketCount);
+  Histogram other(kBucketWidth, kBucketCount);
+  other.AddSample(4.0);
+  histogram.Merge(other);
+  histogram.Reset();
+
+  ExpectSameHistogram(histogram, Histogram(kBucketWidth, kBucketCount));
+}
+
+TEST(HistogramTest, PercentileReportsBucketUpperEdge)
+{
+  Histogram histogram(kBucketWidth, kBucketCount);
+  for(const auto value : {0.1, 0.2, 1.2, 1.3, 2.6}) {
+    histogram.AddSample(value);
+  }
+
+  EXPECT_EQ(histogram.GetPercentile(0.4), 0.5);
+  EXPECT_EQ(histogram.GetPercentile(0.8), 1.5);
+  // The top bucket is capped by the largest sample
+  EXPECT_EQ(histogram.GetPercentile(1.0), 2.6);
+}
+
+}  // namespace
@@ -0,0 +1,212 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "core/log_format.hpp"
+#include "core/log_index.hpp"
+#include "core/log_reader.hpp"
+
+namespace
+{
+
+using ssl_ros_bridge::core::EntryType;
+using ssl_ros_bridge::core::LogIndex;
+namespace log_format = ssl_ros_bridge::core::log_format;
+
+/**
+ * Assembles SSL log bytes in memory, with optional Index2021 entries and trailers.
+ */
+class LogBuilder
+{
+public:
+  LogBuilder()
+  : data_(log_format::kFileHeader.begin(), log_format::kFileHeader.end())
+  {
+  }
+
+  std::size_t AddEntry(
+    const int64_t received_time_ns, const EntryType type,
+    const std::vector<uint8_t> & payload)
+  {
+    const auto offset = data_.size();
+    data_.resize(offset + log_format::kEntryHeaderSize);
+    log_format::WriteBigEndian<int64_t>(received_time_ns, data_.data() + offset);
+    log_format::WriteBigEndian<int32_t>(static_cast<int32_t>(type), data_.data() + offset + 8);
+    log_format::WriteBigEndian<int32_t>(payload.size(), data_.data() + offset + 12);
+    data_.insert(data_.end(), payload.begin(), payload.end());
+    return offset;
+  }
+
+  /**
+   * Appends an Index2021 entry listing the given offsets, followed by the trailer.
+   */
+  std::size_t AddIndex(const std::vector<int64_t> & offsets)
+  {
+    std::vector<uint8_t> payload(offsets.size() * sizeof(int64_t));
+    for(std::size_t i = 0; i < offsets.size(); ++i) {
+      log_format::WriteBigEndian<int64_t>(offsets[i], payload.data() + i * sizeof(int64_t));
+    }
+    const auto index_offset = AddEntry(0, EntryType::Index2021, payload);
+    AddTrailer(index_offset);
+    return index_offset;
+  }
+
+  void AddTrailer(const int64_t index_offset)
+  {
+    const auto offset = data_.size();
+    data_.resize(offset + sizeof(int64_t));
+    log_format::WriteBigEndian<int64_t>(index_offset, data_.data() + offset);
+    data_.insert(data_.end(), log_format::kIndexMarker.begin(), log_format::kIndexMarker.end());
+  }
+
+  std::vector<uint8_t> & GetData()
+  {
+    return data_;
+  }
+
+private:
+  std::vector<uint8_t> data_;
+};
+
+/**
+ * Adds entries received every 100 ns, starting at 100 ns, with payloads of varying size.
+ */
+std::vector<int64_t> AddEntries(LogBuilder & builder, const int count)
+{
+  std::vector<int64_t> offsets;
+  for(int i = 0; i < count; ++i) {
+    offsets.push_back(
+      builder.AddEntry(100 * (i + 1), EntryType::Vision2014, std::vector<uint8_t>(i * 3, 0xAB)));
+  }
+  return offsets;
+}
+
+void ExpectEntries(const LogIndex & index, const std::vector<int64_t> & offsets)
+{
+  ASSERT_EQ(index.GetEntryCount(), offsets.size());
+  for(std::size_t i = 0; i < offsets.size(); ++i) {
+    EXPECT_EQ(index.GetEntryOffset(i), static_cast<std::size_t>(offsets[i]));
+    EXPECT_EQ(index.GetEntryTime(i), static_cast<int64_t>(100 * (i + 1)));
+  }
+}
+
+TEST(LogIndexTest, ScansLogWithoutIndex)
+{
+  LogBuilder builder;
+  const auto offsets = AddEntries(builder, 5);
+  const LogIndex index(builder.GetData());
+
+  EXPECT_FALSE(index.IsFromFile());
+  ExpectEntries(index, offsets);
+  EXPECT_EQ(index.GetEntryOffset(5), builder.GetData().size());
+}
+
+TEST(LogIndexTest, FindsEntriesByTime)
+{
+  LogBuilder builder;
+  AddEntries(builder, 5);
+  const LogIndex index(builder.GetData());
+
+  EXPECT_EQ(index.FindEntryAtTime(0), 0u);
+  EXPECT_EQ(index.FindEntryAtTime(100), 0u);
+  EXPECT_EQ(index.FindEntryAtTime(101), 1u);
+  EXPECT_EQ(index.FindEntryAtTime(300), 2u);
+  EXPECT_EQ(index.FindEntryAtTime(500), 4u);
+  EXPECT_EQ(index.FindEntryAtTime(501), 5u);
+}
+
+TEST(LogIndexTest, LoadsIndexFromTrailer)
+{
+  LogBuilder builder;
+  const auto offsets = AddEntries(builder, 5);
+  const auto index_offset = builder.AddIndex(offsets);
+  const LogIndex index(builder.GetData());
+
+  EXPECT_TRUE(index.IsFromFile());
+  ExpectEntries(index, offsets);
+  EXPECT_EQ(index.GetEntryOffset(5), index_offset);
+  EXPECT_EQ(LogIndex::FindIndexTrailer(builder.GetData()), builder.GetData().size() -
+    log_format::kIndexTrailerSize);
+}
+
+TEST(LogIndexTest, IgnoresIndexEntryListedInItself)
+{
+  LogBuilder builder;
+  const auto offsets = AddEntries(builder, 3);
+  const auto index_offset = builder.GetData().size();
+  auto listed_offsets = offsets;
+  listed_offsets.push_back(index_offset);
+  builder.AddIndex(listed_offsets);
+  const LogIndex index(builder.GetData());
+
+  EXPECT_TRUE(index.IsFromFile());
+  ExpectEntries(index, offsets);
+}
+
+TEST(LogIndexTest, ScansWhenIndexIsCorrupt)
+{
+  LogBuilder builder;
+  const auto offsets = AddEntries(builder, 5);
+  // Offsets out of order cannot come from a valid index
+  builder.AddIndex({offsets[1], offsets[0]});
+  const LogIndex index(builder.GetData());
+
+  EXPECT_FALSE(index.IsFromFile());
+  ExpectEntries(index, offsets);
+}
+
+TEST(LogIndexTest, ScansWhenTrailerPointsOutsideLog)
+{
+  LogBuilder builder;
+  const auto offsets = AddEntries(builder, 5);
+  builder.AddTrailer(static_cast<int64_t>(builder.GetData().size()) + 1000);
+  const LogIndex index(builder.GetData());
+
+  EXPECT_FALSE(index.IsFromFile());
+  ExpectEntries(index, offsets);
+}
+
+TEST(LogIndexTest, StopsAtTruncatedEntry)
+{
+  LogBuilder builder;
+  const auto offsets = AddEntries(builder, 5);
+  const auto end_offset = builder.GetData().size();
+  builder.AddEntry(600, EntryType::Vision2014, std::vector<uint8_t>(50, 0xAB));
+  builder.GetData().resize(builder.GetData().size() - 10);
+  const LogIndex index(builder.GetData());
+
+  ExpectEntries(index, offsets);
+  EXPECT_EQ(index.GetEntryOffset(5), end_offset);
+}
+
+TEST(LogIndexTest, HandlesEmptyLog)
+{
+  LogBuilder builder;
+  const LogIndex index(builder.GetData());
+
+  EXPECT_EQ(index.GetEntryCount(), 0u);
+  EXPECT_EQ(index.GetEntryOffset(0), log_format::kFileHeaderSize);
+  EXPECT_EQ(index.FindEntryAtTime(0), 0u);
+}
+
+}  // namespace
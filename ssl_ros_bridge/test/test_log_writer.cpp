@@ -0,0 +1,195 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+#include "core/log_index.hpp"
+#include "core/log_reader.hpp"
+#include "core/log_writer.hpp"
+#include "core/mapped_file.hpp"
+
+namespace
+{
+
+using ssl_ros_bridge::core::EntryType;
+using ssl_ros_bridge::core::LogIndex;
+using ssl_ros_bridge::core::LogReader;
+using ssl_ros_bridge::core::LogWriter;
+using ssl_ros_bridge::core::MappedFile;
+
+struct TestEntry
+{
+  int64_t received_time_ns;
+  EntryType type;
+  std::vector<uint8_t> data;
+};
+
+std::vector<TestEntry> MakeEntries(const int count)
+{
+  std::vector<TestEntry> entries;
+  for(int i = 0; i < count; ++i) {
+    const auto type = i % 3 == 0 ? EntryType::Refbox2013 : EntryType::Vision2014;
+    // Includes empty payloads and payloads larger than the writer's flush size
+    const std::size_t size = i % 50 == 49 ? 300'000 : (i * 37) % 500;
+    std::vector<uint8_t> data(size);
+    for(std::size_t j = 0; j < size; ++j) {
+      data[j] = static_cast<uint8_t>(i + j);
+    }
+    entries.push_back({1'000'000 * static_cast<int64_t>(i + 1), type, std::move(data)});
+  }
+  return entries;
+}
+
+class LogWriterTest : public ::testing::Test
+{
+protected:
+  std::filesystem::path path_;
+
+  void SetUp() override
+  {
+    const auto test_name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    path_ = std::filesystem::path(::testing::TempDir()) /
+      (std::string(test_name) + "_" + std::to_string(getpid()) + ".log");
+  }
+
+  void TearDown() override
+  {
+    std::filesystem::remove(path_);
+  }
+
+  void ExpectLogContains(const std::vector<TestEntry> & entries)
+  {
+    const MappedFile file(path_);
+    LogReader reader(file.GetData());
+    for(const auto & expected : entries) {
+      const auto entry = reader.GetNextEntry();
+      ASSERT_TRUE(entry.has_value());
+      EXPECT_EQ(entry->received_time_ns, expected.received_time_ns);
+      EXPECT_EQ(entry->type, expected.type);
+      ASSERT_EQ(entry->data.size(), expected.data.size());
+      EXPECT_TRUE(std::equal(entry->data.begin(), entry->data.end(), expected.data.begin()));
+    }
+    const auto index_entry = reader.GetNextEntry();
+    ASSERT_TRUE(index_entry.has_value());
+    EXPECT_EQ(index_entry->type, EntryType::Index2021);
+    EXPECT_FALSE(reader.GetNextEntry().has_value());
+
+    const LogIndex index(file.GetData());
+    EXPECT_TRUE(index.IsFromFile());
+    ASSERT_EQ(index.GetEntryCount(), entries.size());
+    for(std::size_t i = 0; i < entries.size(); ++i) {
+      EXPECT_EQ(index.GetEntryTime(i), entries[i].received_time_ns);
+    }
+  }
+};
+
+TEST_F(LogWriterTest, ReaderReturnsWrittenEntries)
+{
+  const auto entries = MakeEntries(500);
+  {
+    LogWriter writer(path_, nullptr, 64 << 20, LogWriter::FullBufferPolicy::Wait);
+    for(const auto & entry : entries) {
+      ASSERT_TRUE(writer.Write(entry.received_time_ns, entry.type, entry.data));
+    }
+    writer.Close();
+    EXPECT_EQ(writer.GetEntryCount(), entries.size());
+    EXPECT_EQ(writer.GetDroppedEntryCount(), 0u);
+  }
+  ExpectLogContains(entries);
+}
+
+TEST_F(LogWriterTest, EmptyLogHasHeaderAndIndex)
+{
+  {
+    LogWriter writer(path_);
+    writer.Close();
+  }
+  ExpectLogContains({});
+}
+
+TEST_F(LogWriterTest, WaitPolicyKeepsEveryEntryWithSmallBuffer)
+{
+  const auto entries = MakeEntries(2000);
+  {
+    // Smaller than the largest entries, so writers must wait for the disk
+    LogWriter writer(path_, nullptr, 256 << 10, LogWriter::FullBufferPolicy::Wait);
+    for(const auto & entry : entries) {
+      ASSERT_TRUE(writer.Write(entry.received_time_ns, entry.type, entry.data));
+    }
+    writer.Close();
+    EXPECT_EQ(writer.GetDroppedEntryCount(), 0u);
+  }
+  ExpectLogContains(entries);
+}
+
+TEST_F(LogWriterTest, ConcurrentWritersProduceCompleteEntries)
+{
+  constexpr int kThreadCount = 4;
+  constexpr int kEntriesPerThread = 500;
+  {
+    LogWriter writer(path_, nullptr, 64 << 20, LogWriter::FullBufferPolicy::Wait);
+    std::vector<std::thread> threads;
+    for(int t = 0; t < kThreadCount; ++t) {
+      threads.emplace_back(
+        [&writer, t]() {
+          for(int i = 0; i < kEntriesPerThread; ++i) {
+            const std::vector<uint8_t> data(16 + i % 64, static_cast<uint8_t>(t));
+            writer.Write(i, EntryType::Vision2014, data);
+          }
+        });
+    }
+    for(auto & thread : threads) {
+      thread.join();
+    }
+    writer.Close();
+  }
+
+  const MappedFile file(path_);
+  LogReader reader(file.GetData());
+  std::vector<int> entries_per_thread(kThreadCount, 0);
+  while(const auto entry = reader.GetNextMessage()) {
+    ASSERT_FALSE(entry->data.empty());
+    const auto thread_index = entry->data.front();
+    ASSERT_LT(thread_index, kThreadCount);
+    // Entries from different threads must never interleave
+    EXPECT_TRUE(std::all_of(entry->data.begin(), entry->data.end(),
+      [thread_index](const uint8_t byte) {return byte == thread_index;}));
+    entries_per_thread[thread_index]++;
+  }
+  for(const auto count : entries_per_thread) {
+    EXPECT_EQ(count, kEntriesPerThread);
+  }
+}
+
+TEST_F(LogWriterTest, WriteAfterCloseIsRejected)
+{
+  LogWriter writer(path_);
+  writer.Close();
+  const std::vector<uint8_t> data(8, 0);
+  EXPECT_FALSE(writer.Write(1, EntryType::Vision2014, data));
+}
+
+}  // namespace
@@ -0,0 +1,368 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <google/protobuf/util/field_comparator.h>
+#include <google/protobuf/util/message_differencer.h>
+#include <rclcpp/time.hpp>
+#include <tf2/utils.h>
+#include <string>
+#include "core/message_conversion.hpp"
+
+namespace
+{
+
+using ssl_ros_bridge::message_conversion::fromProto;
+using ssl_ros_bridge::message_conversion::toProto;
+
+/**
+ * Compares two messages field by field. Floats may differ slightly, because positions are
+ * converted between float millimetres and metres.
+ */
+::testing::AssertionResult ProtoNear(
+  const google::protobuf::Message & expected,
+  const google::protobuf::Message & actual)
+{
+  google::protobuf::util::DefaultFieldComparator comparator;
+  comparator.set_float_comparison(google::protobuf::util::DefaultFieldComparator::APPROXIMATE);
+  comparator.SetDefaultFractionAndMargin(1e-6, 1e-4);
+  google::protobuf::util::MessageDifferencer differencer;
+  differencer.set_field_comparator(&comparator);
+  std::string differences;
+  differencer.ReportDifferencesToString(&differences);
+  if(differencer.Compare(expected, actual)) {
+    return ::testing::AssertionSuccess();
+  }
+  return ::testing::AssertionFailure() << differences;
+}
+
+SSL_DetectionRobot MakeRobot(const uint32_t id, const float x, const float y, const float yaw)
+{
+  SSL_DetectionRobot robot;
+  robot.set_confidence(0.9f);
+  robot.set_robot_id(id);
+  robot.set_x(x);
+  robot.set_y(y);
+  robot.set_orientation(yaw);
+  robot.set_pixel_x(320.0f);
+  robot.set_pixel_y(240.0f);
+  robot.set_height(150.0f);
+  return robot;
+}
+
+SSL_WrapperPacket MakeVisionPacket()
+{
+  SSL_WrapperPacket packet;
+
+  auto & detection = *packet.mutable_detection();
+  detection.set_frame_number(4242);
+  detection.set_t_capture(1700000000.25);
+  detection.set_t_sent(1700000000.5);
+  detection.set_t_capture_camera(1700000000.125);
+  detection.set_camera_id(3);
+  auto & ball = *detection.add_balls();
+  ball.set_confidence(0.75f);
+  ball.set_area(120);
+  ball.set_x(1500.0f);
+  ball.set_y(-750.0f);
+  ball.set_z(42.0f);
+  ball.set_pixel_x(100.5f);
+  ball.set_pixel_y(200.5f);
+  *detection.add_robots_yellow() = MakeRobot(1, -2000.0f, 1000.0f, 1.25f);
+  *detection.add_robots_blue() = MakeRobot(7, 3000.0f, -500.0f, -2.5f);
+
+  auto & field = *packet.mutable_geometry()->mutable_field();
+  field.set_field_length(12000);
+  field.set_field_width(9000);
+  field.set_goal_width(1800);
+  field.set_goal_depth(180);
+  field.set_boundary_width(300);
+  auto & line = *field.add_field_lines();
+  line.set_name("LeftGoalLine");
+  line.mutable_p1()->set_x(-6000.0f);
+  line.mutable_p1()->set_y(-4500.0f);
+  line.mutable_p2()->set_x(-6000.0f);
+  line.mutable_p2()->set_y(4500.0f);
+  line.set_thickness(10.0f);
+  auto & arc = *field.add_field_arcs();
+  arc.set_name("CenterCircle");
+  arc.mutable_center()->set_x(0.0f);
+  arc.mutable_center()->set_y(0.0f);
+  arc.set_radius(500.0f);
+  arc.set_a1(0.0f);
+  arc.set_a2(6.2831855f);
+  arc.set_thickness(10.0f);
+  // Only some of the optional sizes, so missing ones must stay missing
+  field.set_penalty_area_depth(1800);
+  field.set_penalty_area_width(3600);
+  field.set_goal_height(155);
+
+  auto & calibration = *packet.mutable_geometry()->add_calib();
+  calibration.set_camera_id(3);
+  calibration.set_focal_length(560.0f);
+  calibration.set_principal_point_x(390.0f);
+  calibration.set_principal_point_y(290.0f);
+  calibration.set_distortion(0.15f);
+  calibration.set_q0(0.7f);
+  calibration.set_q1(-0.7f);
+  calibration.set_q2(0.1f);
+  calibration.set_q3(0.05f);
+  calibration.set_tx(-150.0f);
+  calibration.set_ty(200.0f);
+  calibration.set_tz(4000.0f);
+  calibration.set_derived_camera_world_tx(-3000.0f);
+  calibration.set_derived_camera_world_ty(2250.0f);
+  calibration.set_derived_camera_world_tz(4000.0f);
+
+  return packet;
+}
+
+Referee::TeamInfo MakeTeamInfo(const std::string & name, const uint32_t goalkeeper)
+{
+  Referee::TeamInfo team;
+  team.set_name(name);
+  team.set_score(2);
+  team.set_red_cards(1);
+  team.add_yellow_card_times(45000000);
+  team.add_yellow_card_times(12000000);
+  team.set_yellow_cards(3);
+  team.set_timeouts(2);
+  team.set_timeout_time(180000000);
+  team.set_goalkeeper(goalkeeper);
+  team.set_foul_counter(4);
+  team.set_can_place_ball(true);
+  team.set_max_allowed_bots(10);
+  return team;
+}
+
+Referee MakeReferee()
+{
+  Referee referee;
+  referee.set_source_identifier("gc-1");
+  referee.set_match_type(MatchType::GROUP_PHASE);
+  referee.set_packet_timestamp(1700000000123456);
+  referee.set_stage(Referee::NORMAL_FIRST_HALF);
+  referee.set_stage_time_left(-1500000);
+  referee.set_command(Referee::BALL_PLACEMENT_BLUE);
+  referee.set_command_counter(17);
+  referee.set_command_timestamp(1700000000000001);
+  *referee.mutable_yellow() = MakeTeamInfo("Yellow Team", 0);
+  *referee.mutable_blue() = MakeTeamInfo("Blue Team", 5);
+  referee.mutable_designated_position()->set_x(1500.0f);
+  referee.mutable_designated_position()->set_y(-2250.0f);
+  referee.set_blue_team_on_positive_half(true);
+  referee.set_next_command(Referee::DIRECT_FREE_BLUE);
+
+  auto & left_field = *referee.add_game_events();
+  left_field.set_id("event-1");
+  left_field.set_type(GameEvent::BALL_LEFT_FIELD_TOUCH_LINE);
+  left_field.add_origin("GC");
+  left_field.add_origin("TIGERs AutoRef");
+  left_field.set_created_timestamp(1700000000000002);
+  auto & touch_line = *left_field.mutable_ball_left_field_touch_line();
+  touch_line.set_by_team(Team::YELLOW);
+  touch_line.set_by_bot(3);
+  touch_line.mutable_location()->set_x(2.5f);
+  touch_line.mutable_location()->set_y(4.5f);
+
+  // Neither an id nor a creation time
+  auto & no_progress = *referee.add_game_events();
+  no_progress.set_type(GameEvent::NO_PROGRESS_IN_GAME);
+  no_progress.mutable_no_progress_in_game()->set_time(10.5f);
+
+  auto & proposal = *referee.add_game_event_proposals();
+  proposal.set_id("proposal-1");
+  proposal.set_accepted(false);
+  auto & goal = *proposal.add_game_events();
+  goal.set_type(GameEvent::POSSIBLE_GOAL);
+  goal.mutable_possible_goal()->set_by_team(Team::BLUE);
+  goal.mutable_possible_goal()->set_kicking_bot(4);
+  goal.mutable_possible_goal()->set_max_ball_height(0.25f);
+
+  referee.set_current_action_time_remaining(8000000);
+  referee.set_status_message("Ball placement");
+  return referee;
+}
+
+TEST(MessageConversionTest, VisionPacketSurvivesRoundTrip)
+{
+  const auto packet = MakeVisionPacket();
+  ASSERT_TRUE(packet.IsInitialized());
+
+  const auto round_trip = toProto(fromProto(packet));
+
+  ASSERT_TRUE(round_trip.IsInitialized());
+  EXPECT_TRUE(ProtoNear(packet, round_trip));
+  // Missing optional sizes are zero in the ROS message, which must not turn into present zeros
+  EXPECT_FALSE(round_trip.geometry().field().has_center_circle_radius());
+  EXPECT_FALSE(round_trip.geometry().field().has_ball_radius());
+}
+
+TEST(MessageConversionTest, VisionPacketIsConvertedToMetres)
+{
+  const auto wrapper = fromProto(MakeVisionPacket());
+
+  ASSERT_EQ(wrapper.detection.size(), 1u);
+  const auto & detection = wrapper.detection.front();
+  ASSERT_EQ(detection.balls.size(), 1u);
+  EXPECT_NEAR(detection.balls.front().pos.x, 1.5, 1e-6);
+  EXPECT_NEAR(detection.balls.front().pos.y, -0.75, 1e-6);
+  EXPECT_NEAR(detection.balls.front().pos.z, 0.042, 1e-6);
+  ASSERT_EQ(detection.robots_yellow.size(), 1u);
+  EXPECT_NEAR(detection.robots_yellow.front().pose.position.x, -2.0, 1e-6);
+  EXPECT_NEAR(tf2::getYaw(detection.robots_yellow.front().pose.orientation), 1.25, 1e-6);
+  ASSERT_EQ(detection.robots_blue.size(), 1u);
+  EXPECT_NEAR(tf2::getYaw(detection.robots_blue.front().pose.orientation), -2.5, 1e-6);
+
+  ASSERT_EQ(wrapper.geometry.size(), 1u);
+  const auto & field = wrapper.geometry.front().field;
+  EXPECT_NEAR(field.field_length, 12.0, 1e-6);
+  EXPECT_NEAR(field.penalty_area_depth, 1.8, 1e-6);
+  EXPECT_EQ(field.center_circle_radius, 0.0f);
+  ASSERT_EQ(field.field_arcs.size(), 1u);
+  EXPECT_NEAR(field.field_arcs.front().radius, 0.5, 1e-6);
+}
+
+TEST(MessageConversionTest, VisionMessageSurvivesRoundTrip)
+{
+  const auto wrapper = fromProto(MakeVisionPacket());
+
+  const auto round_trip = fromProto(toProto(wrapper));
+
+  ASSERT_EQ(round_trip.detection.size(), 1u);
+  const auto & detection = round_trip.detection.front();
+  const auto & expected_detection = wrapper.detection.front();
+  EXPECT_EQ(detection.frame_number, expected_detection.frame_number);
+  EXPECT_EQ(detection.camera_id, expected_detection.camera_id);
+  EXPECT_EQ(rclcpp::Time(detection.t_capture).nanoseconds(),
+    rclcpp::Time(expected_detection.t_capture).nanoseconds());
+  EXPECT_EQ(rclcpp::Time(detection.t_capture_camera).nanoseconds(),
+    rclcpp::Time(expected_detection.t_capture_camera).nanoseconds());
+  ASSERT_EQ(detection.balls.size(), 1u);
+  EXPECT_NEAR(detection.balls.front().pos.x, expected_detection.balls.front().pos.x, 1e-6);
+  EXPECT_NEAR(detection.balls.front().pos.z, expected_detection.balls.front().pos.z, 1e-6);
+  ASSERT_EQ(detection.robots_blue.size(), 1u);
+  const auto & robot = detection.robots_blue.front();
+  const auto & expected_robot = expected_detection.robots_blue.front();
+  EXPECT_EQ(robot.robot_id, expected_robot.robot_id);
+  EXPECT_NEAR(robot.pose.position.y, expected_robot.pose.position.y, 1e-6);
+  EXPECT_NEAR(tf2::getYaw(robot.pose.orientation), tf2::getYaw(expected_robot.pose.orientation),
+    1e-6);
+  EXPECT_NEAR(robot.height, expected_robot.height, 1e-6);
+
+  ASSERT_EQ(round_trip.geometry.size(), 1u);
+  const auto & field = round_trip.geometry.front().field;
+  const auto & expected_field = wrapper.geometry.front().field;
+  EXPECT_NEAR(field.goal_width, expected_field.goal_width, 1e-6);
+  EXPECT_NEAR(field.goal_height, expected_field.goal_height, 1e-6);
+  EXPECT_EQ(field.ball_radius, 0.0f);
+  ASSERT_EQ(field.field_lines.size(), 1u);
+  EXPECT_EQ(field.field_lines.front().name, expected_field.field_lines.front().name);
+  EXPECT_NEAR(field.field_lines.front().p2.y, expected_field.field_lines.front().p2.y, 1e-6);
+  ASSERT_EQ(round_trip.geometry.front().calibration.size(), 1u);
+  const auto & calibration = round_trip.geometry.front().calibration.front();
+  const auto & expected_calibration = wrapper.geometry.front().calibration.front();
+  EXPECT_NEAR(calibration.pose.position.z, expected_calibration.pose.position.z, 1e-6);
+  EXPECT_NEAR(calibration.pose.orientation.w, expected_calibration.pose.orientation.w, 1e-6);
+}
+
+TEST(MessageConversionTest, VisionPacketWithoutCameraCaptureTimeKeepsItMissing)
+{
+  auto packet = MakeVisionPacket();
+  packet.mutable_detection()->clear_t_capture_camera();
+  packet.clear_geometry();
+
+  const auto round_trip = toProto(fromProto(packet));
+
+  EXPECT_FALSE(round_trip.has_geometry());
+  EXPECT_FALSE(round_trip.detection().has_t_capture_camera());
+  EXPECT_TRUE(ProtoNear(packet, round_trip));
+}
+
+TEST(MessageConversionTest, RefereeSurvivesRoundTrip)
+{
+  const auto referee = MakeReferee();
+  ASSERT_TRUE(referee.IsInitialized());
+
+  const auto round_trip = toProto(fromProto(referee));
+
+  ASSERT_TRUE(round_trip.IsInitialized());
+  EXPECT_TRUE(ProtoNear(referee, round_trip));
+  EXPECT_FALSE(round_trip.game_events(1).has_id());
+  EXPECT_FALSE(round_trip.game_events(1).has_created_timestamp());
+}
+
+TEST(MessageConversionTest, RefereeIsConvertedToRosUnits)
+{
+  const auto message = fromProto(MakeReferee());
+
+  // packet_timestamp is in microseconds
+  EXPECT_EQ(rclcpp::Time(message.timestamp).nanoseconds(), 1700000000123456000);
+  ASSERT_EQ(message.designated_position.size(), 1u);
+  EXPECT_NEAR(message.designated_position.front().x, 1.5, 1e-6);
+  EXPECT_NEAR(message.designated_position.front().y, -2.25, 1e-6);
+  ASSERT_EQ(message.game_events.size(), 2u);
+  EXPECT_EQ(message.game_events.front().id, "event-1");
+  ASSERT_EQ(message.game_events.front().ball_left_field_touch_line.size(), 1u);
+  // Game event locations are already in metres
+  const auto & location = message.game_events.front().ball_left_field_touch_line.front().location;
+  ASSERT_EQ(location.size(), 1u);
+  EXPECT_NEAR(location.front().x, 2.5, 1e-6);
+  EXPECT_TRUE(message.game_events.back().id.empty());
+  ASSERT_EQ(message.game_event_proposals.size(), 1u);
+  EXPECT_EQ(message.game_event_proposals.front().game_events.size(), 1u);
+}
+
+TEST(MessageConversionTest, RefereeMessageSurvivesRoundTrip)
+{
+  const auto message = fromProto(MakeReferee());
+
+  const auto round_trip = fromProto(toProto(message));
+
+  EXPECT_EQ(round_trip.source_identifier, message.source_identifier);
+  EXPECT_EQ(round_trip.match_type, message.match_type);
+  EXPECT_EQ(rclcpp::Time(round_trip.timestamp).nanoseconds(),
+    rclcpp::Time(message.timestamp).nanoseconds());
+  EXPECT_EQ(rclcpp::Time(round_trip.command_timestamp).nanoseconds(),
+    rclcpp::Time(message.command_timestamp).nanoseconds());
+  EXPECT_EQ(round_trip.stage, message.stage);
+  EXPECT_EQ(round_trip.stage_time_left, message.stage_time_left);
+  EXPECT_EQ(round_trip.command, message.command);
+  EXPECT_EQ(round_trip.command_counter, message.command_counter);
+  EXPECT_EQ(round_trip.yellow.name, message.yellow.name);
+  EXPECT_EQ(round_trip.yellow.yellow_card_times, message.yellow.yellow_card_times);
+  EXPECT_EQ(round_trip.blue.goalkeeper, message.blue.goalkeeper);
+  EXPECT_EQ(round_trip.blue.foul_counter, message.blue.foul_counter);
+  EXPECT_EQ(round_trip.blue.bot_substitution_intent, message.blue.bot_substitution_intent);
+  ASSERT_EQ(round_trip.designated_position.size(), 1u);
+  EXPECT_NEAR(round_trip.designated_position.front().x, message.designated_position.front().x,
+    1e-6);
+  EXPECT_NEAR(round_trip.designated_position.front().y, message.designated_position.front().y,
+    1e-6);
+  EXPECT_EQ(round_trip.next_command, message.next_command);
+  ASSERT_EQ(round_trip.game_events.size(), message.game_events.size());
+  EXPECT_EQ(round_trip.game_events.front().origin, message.game_events.front().origin);
+  EXPECT_EQ(round_trip.game_events.front().created_timestamp,
+    message.game_events.front().created_timestamp);
+  EXPECT_EQ(round_trip.game_events.back().no_progress_in_game.size(), 1u);
+  EXPECT_EQ(round_trip.status_message, message.status_message);
+}
+
+}  // namespace
@@ -0,0 +1,329 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include "core/log_format.hpp"
+#include "core/pcap_reader.hpp"
+
+namespace
+{
+
+using ssl_ros_bridge::core::CapturedPacket;
+using ssl_ros_bridge::core::IsPacketCapture;
+using ssl_ros_bridge::core::LinkType;
+using ssl_ros_bridge::core::PcapReader;
+
+constexpr int64_t kSecondNs = 1'000'000'000;
+
+/**
+ * Appends integers to a capture in either byte order.
+ */
+class CaptureBuilder
+{
+public:
+  explicit CaptureBuilder(const bool big_endian)
+  : big_endian_(big_endian)
+  {
+  }
+
+  template<typename T>
+  void Append(const T value)
+  {
+    const auto unsigned_value = static_cast<std::make_unsigned_t<T>>(value);
+    for(std::size_t i = 0; i < sizeof(T); ++i) {
+      const auto shift = big_endian_ ? 8 * (sizeof(T) - 1 - i) : 8 * i;
+      data_.push_back(static_cast<uint8_t>(unsigned_value >> shift));
+    }
+  }
+
+  void Append(const std::vector<uint8_t> & bytes)
+  {
+    data_.insert(data_.end(), bytes.begin(), bytes.end());
+  }
+
+  void PadToFourBytes()
+  {
+    data_.resize((data_.size() + 3) & ~std::size_t{3}, 0);
+  }
+
+  std::vector<uint8_t> & GetData()
+  {
+    return data_;
+  }
+
+  bool IsBigEndian() const
+  {
+    return big_endian_;
+  }
+
+private:
+  bool big_endian_;
+  std::vector<uint8_t> data_;
+};
+
+class PcapBuilder : public CaptureBuilder
+{
+public:
+  PcapBuilder(const bool big_endian, const bool nanosecond, const LinkType link_type)
+  : CaptureBuilder(big_endian)
+  {
+    Append<uint32_t>(nanosecond ? 0xA1B23C4D : 0xA1B2C3D4);
+    Append<uint16_t>(2);
+    Append<uint16_t>(4);
+    Append<int32_t>(0);
+    Append<uint32_t>(0);
+    Append<uint32_t>(65535);
+    Append<uint32_t>(static_cast<uint32_t>(link_type));
+  }
+
+  void AddPacket(const uint32_t seconds, const uint32_t fraction, const std::vector<uint8_t> & data)
+  {
+    Append(seconds);
+    Append(fraction);
+    Append<uint32_t>(data.size());
+    Append<uint32_t>(data.size());
+    Append(data);
+  }
+};
+
+class PcapngBuilder : public CaptureBuilder
+{
+public:
+  explicit PcapngBuilder(const bool big_endian)
+  : CaptureBuilder(big_endian)
+  {
+    AddSectionHeader();
+  }
+
+  void AddSectionHeader()
+  {
+    const auto start = StartBlock(0x0A0D0D0A);
+    Append<uint32_t>(0x1A2B3C4D);
+    Append<uint16_t>(1);
+    Append<uint16_t>(0);
+    Append<int64_t>(-1);
+    EndBlock(start);
+  }
+
+  /**
+   * @param timestamp_resolution Raw if_tsresol value, or zero to leave the option out
+   */
+  void AddInterface(
+    const LinkType link_type, const uint8_t timestamp_resolution = 0,
+    const int64_t timestamp_offset_s = 0)
+  {
+    const auto start = StartBlock(1);
+    Append<uint16_t>(static_cast<uint16_t>(link_type));
+    Append<uint16_t>(0);
+    Append<uint32_t>(65535);
+    if(timestamp_resolution != 0) {
+      Append<uint16_t>(9);
+      Append<uint16_t>(1);
+      Append(std::vector<uint8_t>{timestamp_resolution});
+      PadToFourBytes();
+    }
+    if(timestamp_offset_s != 0) {
+      Append<uint16_t>(14);
+      Append<uint16_t>(8);
+      Append(timestamp_offset_s);
+    }
+    Append<uint16_t>(0);
+    Append<uint16_t>(0);
+    EndBlock(start);
+  }
+
+  void AddEnhancedPacket(
+    const uint32_t interface_id, const uint64_t timestamp, const std::vector<uint8_t> & data)
+  {
+    const auto start = StartBlock(6);
+    Append(interface_id);
+    Append<uint32_t>(timestamp >> 32);
+    Append<uint32_t>(timestamp & 0xFFFFFFFF);
+    Append<uint32_t>(data.size());
+    Append<uint32_t>(data.size());
+    Append(data);
+    PadToFourBytes();
+    EndBlock(start);
+  }
+
+  void AddSimplePacket(const std::vector<uint8_t> & data)
+  {
+    const auto start = StartBlock(3);
+    Append<uint32_t>(data.size());
+    Append(data);
+    PadToFourBytes();
+    EndBlock(start);
+  }
+
+private:
+  std::size_t StartBlock(const uint32_t type)
+  {
+    const auto start = GetData().size();
+    Append(type);
+    // Filled in by EndBlock()
+    Append<uint32_t>(0);
+    return start;
+  }
+
+  void EndBlock(const std::size_t start)
+  {
+    const auto length = static_cast<uint32_t>(GetData().size() + sizeof(uint32_t) - start);
+    Append(length);
+    CaptureBuilder length_bytes(IsBigEndian());
+    length_bytes.Append(length);
+    std::copy(
+      length_bytes.GetData().begin(), length_bytes.GetData().end(),
+      GetData().begin() + start + sizeof(uint32_t));
+  }
+};
+
+void ExpectPacket(
+  const std::optional<CapturedPacket> & packet, const int64_t capture_time_ns,
+  const LinkType link_type, const std::vector<uint8_t> & data)
+{
+  ASSERT_TRUE(packet.has_value());
+  EXPECT_EQ(packet->capture_time_ns, capture_time_ns);
+  EXPECT_EQ(packet->link_type, link_type);
+  EXPECT_EQ(std::vector<uint8_t>(packet->data.begin(), packet->data.end()), data);
+}
+
+TEST(PcapReaderTest, DetectsCaptureFormats)
+{
+  for(const auto big_endian : {false, true}) {
+    for(const auto nanosecond : {false, true}) {
+      EXPECT_TRUE(IsPacketCapture(PcapBuilder(big_endian, nanosecond, LinkType::Raw).GetData()));
+    }
+    EXPECT_TRUE(IsPacketCapture(PcapngBuilder(big_endian).GetData()));
+  }
+  const std::vector<uint8_t> log_header(
+    ssl_ros_bridge::core::log_format::kFileHeader.begin(),
+    ssl_ros_bridge::core::log_format::kFileHeader.end());
+  EXPECT_FALSE(IsPacketCapture(log_header));
+  EXPECT_FALSE(IsPacketCapture(std::vector<uint8_t>{0xD4, 0xC3}));
+  EXPECT_THROW(PcapReader{log_header}, std::runtime_error);
+}
+
+TEST(PcapReaderTest, ReadsMicrosecondPcap)
+{
+  PcapBuilder builder(false, false, LinkType::Ethernet);
+  builder.AddPacket(10, 500'000, {1, 2, 3});
+  builder.AddPacket(11, 0, {});
+  builder.AddPacket(11, 999'999, {4, 5});
+  PcapReader reader(builder.GetData());
+
+  ExpectPacket(reader.GetNextPacket(), 10 * kSecondNs + 500'000'000, LinkType::Ethernet, {1, 2, 3});
+  ExpectPacket(reader.GetNextPacket(), 11 * kSecondNs, LinkType::Ethernet, {});
+  ExpectPacket(reader.GetNextPacket(), 11 * kSecondNs + 999'999'000, LinkType::Ethernet, {4, 5});
+  EXPECT_FALSE(reader.GetNextPacket().has_value());
+  EXPECT_EQ(reader.GetProgress(), 1.0);
+}
+
+TEST(PcapReaderTest, ReadsBigEndianNanosecondPcap)
+{
+  PcapBuilder builder(true, true, LinkType::LinuxSll);
+  builder.AddPacket(3, 123'456'789, {9, 8, 7, 6});
+  PcapReader reader(builder.GetData());
+
+  ExpectPacket(reader.GetNextPacket(), 3 * kSecondNs + 123'456'789, LinkType::LinuxSll,
+    {9, 8, 7, 6});
+  EXPECT_FALSE(reader.GetNextPacket().has_value());
+}
+
+TEST(PcapReaderTest, TruncatedPcapRecordEndsCapture)
+{
+  PcapBuilder builder(false, false, LinkType::Raw);
+  builder.AddPacket(1, 0, {1, 2, 3});
+  builder.AddPacket(2, 0, std::vector<uint8_t>(100, 0));
+  builder.GetData().resize(builder.GetData().size() - 50);
+  PcapReader reader(builder.GetData());
+
+  ExpectPacket(reader.GetNextPacket(), kSecondNs, LinkType::Raw, {1, 2, 3});
+  EXPECT_FALSE(reader.GetNextPacket().has_value());
+  EXPECT_EQ(reader.GetProgress(), 1.0);
+}
+
+TEST(PcapReaderTest, ReadsPcapngInterfaces)
+{
+  for(const auto big_endian : {false, true}) {
+    PcapngBuilder builder(big_endian);
+    builder.AddInterface(LinkType::Ethernet);
+    // Nanosecond timestamps, and 2^-10 second timestamps with an offset of 100 seconds
+    builder.AddInterface(LinkType::Raw, 9);
+    builder.AddInterface(LinkType::LinuxSll2, 0x80 | 10, 100);
+    builder.AddEnhancedPacket(0, 5'000'001, {1});
+    builder.AddSimplePacket({2, 2});
+    builder.AddEnhancedPacket(1, 7 * kSecondNs + 3, {3, 3, 3});
+    builder.AddEnhancedPacket(2, 1024 + 512, {4, 4, 4, 4, 4});
+    PcapReader reader(builder.GetData());
+
+    ExpectPacket(reader.GetNextPacket(), 5 * kSecondNs + 1'000, LinkType::Ethernet, {1});
+    ExpectPacket(reader.GetNextPacket(), 7 * kSecondNs + 3, LinkType::Raw, {3, 3, 3});
+    ExpectPacket(reader.GetNextPacket(), 101 * kSecondNs + 500'000'000, LinkType::LinuxSll2,
+      {4, 4, 4, 4, 4});
+    EXPECT_FALSE(reader.GetNextPacket().has_value());
+  }
+}
+
+TEST(PcapReaderTest, TruncatedPcapngBlockEndsCapture)
+{
+  PcapngBuilder builder(false);
+  builder.AddInterface(LinkType::Raw);
+  builder.AddEnhancedPacket(0, 1, {1, 2, 3, 4});
+  builder.AddEnhancedPacket(0, 2, std::vector<uint8_t>(64, 0));
+  builder.GetData().resize(builder.GetData().size() - 20);
+  PcapReader reader(builder.GetData());
+
+  ExpectPacket(reader.GetNextPacket(), 1'000, LinkType::Raw, {1, 2, 3, 4});
+  EXPECT_FALSE(reader.GetNextPacket().has_value());
+}
+
+TEST(PcapReaderTest, NewSectionForgetsInterfaces)
+{
+  PcapngBuilder builder(false);
+  builder.AddInterface(LinkType::Raw);
+  builder.AddEnhancedPacket(0, 1, {1});
+  builder.AddSectionHeader();
+  builder.AddEnhancedPacket(0, 2, {2});
+  PcapReader reader(builder.GetData());
+
+  ExpectPacket(reader.GetNextPacket(), 1'000, LinkType::Raw, {1});
+  EXPECT_THROW(reader.GetNextPacket(), std::runtime_error);
+}
+
+TEST(PcapReaderTest, RejectsInvalidBlockLength)
+{
+  PcapngBuilder builder(false);
+  builder.AddInterface(LinkType::Raw);
+  const auto block_offset = builder.GetData().size();
+  builder.AddEnhancedPacket(0, 1, {1, 2, 3, 4});
+  // Not a multiple of four
+  builder.GetData()[block_offset + 4] += 1;
+  PcapReader reader(builder.GetData());
+
+  EXPECT_THROW(reader.GetNextPacket(), std::runtime_error);
+}
+
+}  // namespace
@@ -0,0 +1,241 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include "game_controller_bridge/referee_source_selector.hpp"
+
+namespace
+{
+
+using ssl_ros_bridge::game_controller_bridge::RefereeSourceSelector;
+using Decision = RefereeSourceSelector::Decision;
+using std::chrono::milliseconds;
+
+constexpr uint64_t kStartTimestamp = 1'000'000'000;
+
+class RefereeSourceSelectorTest : public ::testing::Test
+{
+protected:
+  explicit RefereeSourceSelectorTest(const std::string & preferred_source = "")
+  : selector_(1.0, milliseconds(100), preferred_source, milliseconds(30), milliseconds(1000))
+  {
+  }
+
+  /** Receives a packet from source at the given time since the start of the test. */
+  Decision Receive(
+    const std::string & source, const milliseconds time, const uint32_t command_counter = 0,
+    const std::optional<uint64_t> packet_timestamp = std::nullopt)
+  {
+    Referee referee;
+    referee.set_source_identifier(source);
+    referee.set_packet_timestamp(
+      packet_timestamp.value_or(kStartTimestamp + static_cast<uint64_t>(time.count()) * 1000));
+    referee.set_command_counter(command_counter);
+    return selector_.Process(referee, "10.0.0.1", start_ + time);
+  }
+
+  const std::chrono::steady_clock::time_point start_{std::chrono::seconds(100)};
+  RefereeSourceSelector selector_;
+};
+
+class PreferredSourceTest : public RefereeSourceSelectorTest
+{
+protected:
+  PreferredSourceTest()
+  : RefereeSourceSelectorTest("a")
+  {
+  }
+};
+
+TEST_F(RefereeSourceSelectorTest, FirstSourceBecomesPrimary)
+{
+  EXPECT_EQ(Receive("a", milliseconds(0)), Decision::AcceptAfterSwitch);
+  EXPECT_EQ(Receive("b", milliseconds(50)), Decision::RejectBackup);
+  EXPECT_EQ(Receive("a", milliseconds(100)), Decision::Accept);
+
+  const auto metrics = selector_.GetMetrics();
+  EXPECT_EQ(metrics.primary_source, "a");
+  EXPECT_EQ(metrics.source_count, 2u);
+  EXPECT_EQ(metrics.accepted_packets, 2u);
+  EXPECT_EQ(metrics.rejected_backup_packets, 1u);
+  EXPECT_EQ(metrics.switch_count, 1u);
+}
+
+TEST_F(RefereeSourceSelectorTest, RejectsDuplicateAndOutdatedPackets)
+{
+  ASSERT_EQ(Receive("a", milliseconds(0), 5), Decision::AcceptAfterSwitch);
+  ASSERT_EQ(Receive("a", milliseconds(100), 5), Decision::Accept);
+
+  // The same packet received twice
+  EXPECT_EQ(
+    Receive("a", milliseconds(101), 5, kStartTimestamp + 100'000),
+    Decision::RejectDuplicate);
+  // A reordered packet with an older timestamp
+  EXPECT_EQ(Receive("a", milliseconds(102), 5, kStartTimestamp + 50'000), Decision::RejectOutdated);
+  // A reordered packet from before the last command change
+  EXPECT_EQ(Receive("a", milliseconds(200), 6), Decision::Accept);
+  EXPECT_EQ(
+    Receive("a", milliseconds(201), 5, kStartTimestamp + 150'000),
+    Decision::RejectOutdated);
+  EXPECT_EQ(Receive("a", milliseconds(300), 6), Decision::Accept);
+
+  const auto metrics = selector_.GetMetrics();
+  EXPECT_EQ(metrics.accepted_packets, 4u);
+  EXPECT_EQ(metrics.rejected_duplicate_packets, 1u);
+  EXPECT_EQ(metrics.rejected_outdated_packets, 2u);
+  EXPECT_EQ(metrics.reset_count, 0u);
+}
+
+TEST_F(RefereeSourceSelectorTest, AcceptsRestartedPrimary)
+{
+  ASSERT_EQ(Receive("a", milliseconds(0), 42), Decision::AcceptAfterSwitch);
+  ASSERT_EQ(Receive("a", milliseconds(100), 42), Decision::Accept);
+
+  // A restarted game controller counts commands from zero while its clock keeps going
+  EXPECT_EQ(Receive("a", milliseconds(200), 0), Decision::AcceptAfterReset);
+  EXPECT_EQ(Receive("a", milliseconds(300), 1), Decision::Accept);
+  EXPECT_EQ(selector_.GetMetrics().reset_count, 1u);
+}
+
+TEST_F(RefereeSourceSelectorTest, AcceptsClockStepBack)
+{
+  ASSERT_EQ(Receive("a", milliseconds(0), 3), Decision::AcceptAfterSwitch);
+  ASSERT_EQ(Receive("a", milliseconds(100), 3), Decision::Accept);
+
+  // More than a second back can not be reordering
+  EXPECT_EQ(
+    Receive("a", milliseconds(200), 3, kStartTimestamp - 5'000'000),
+    Decision::AcceptAfterReset);
+  EXPECT_EQ(Receive("a", milliseconds(300), 3, kStartTimestamp - 4'900'000), Decision::Accept);
+  // The old sequence is outdated now
+  EXPECT_EQ(
+    Receive("a", milliseconds(400), 3, kStartTimestamp - 4'950'000),
+    Decision::RejectOutdated);
+  EXPECT_EQ(selector_.GetMetrics().reset_count, 1u);
+}
+
+TEST_F(RefereeSourceSelectorTest, AcceptsSmallStepBackAfterRepeatedOutdatedPackets)
+{
+  ASSERT_EQ(Receive("a", milliseconds(0), 3), Decision::AcceptAfterSwitch);
+
+  // Within the reorder window, but the primary keeps sending the older sequence
+  EXPECT_EQ(
+    Receive("a", milliseconds(100), 3, kStartTimestamp - 500'000),
+    Decision::RejectOutdated);
+  EXPECT_EQ(
+    Receive("a", milliseconds(200), 3, kStartTimestamp - 400'000),
+    Decision::RejectOutdated);
+  EXPECT_EQ(
+    Receive("a", milliseconds(300), 3, kStartTimestamp - 300'000),
+    Decision::AcceptAfterReset);
+  EXPECT_EQ(Receive("a", milliseconds(400), 3, kStartTimestamp - 200'000), Decision::Accept);
+}
+
+TEST_F(RefereeSourceSelectorTest, FailsOverAfterPrimaryIsSilent)
+{
+  // b is 50 ms out of phase with a
+  for(int time = 0; time < 2000; time += 100) {
+    ASSERT_NE(Receive("a", milliseconds(time), 1), Decision::RejectBackup);
+    ASSERT_EQ(Receive("b", milliseconds(time + 50), 7), Decision::RejectBackup);
+  }
+
+  // a's last packet was at 1900 ms. 100 ms period plus 30 ms margin have not passed yet.
+  EXPECT_EQ(Receive("b", milliseconds(2020), 7), Decision::RejectBackup);
+  EXPECT_EQ(Receive("b", milliseconds(2040), 7), Decision::AcceptAfterSwitch);
+  // b's smaller command counter is not outdated, because it starts a new sequence
+  EXPECT_EQ(Receive("b", milliseconds(2140), 7), Decision::Accept);
+  EXPECT_EQ(Receive("a", milliseconds(2200), 1), Decision::RejectBackup);
+
+  const auto metrics = selector_.GetMetrics();
+  EXPECT_EQ(metrics.primary_source, "b");
+  EXPECT_EQ(metrics.switch_count, 2u);
+  EXPECT_EQ(metrics.last_switch_time, start_ + milliseconds(2040));
+  EXPECT_EQ(metrics.last_switch_gap, milliseconds(140));
+}
+
+TEST_F(PreferredSourceTest, SwitchesBackToPreferredSource)
+{
+  // a is not running yet
+  ASSERT_EQ(Receive("b", milliseconds(0)), Decision::AcceptAfterSwitch);
+  ASSERT_EQ(Receive("b", milliseconds(100)), Decision::Accept);
+
+  // a comes up, but b became primary too recently
+  EXPECT_EQ(Receive("a", milliseconds(150)), Decision::RejectBackup);
+  EXPECT_EQ(Receive("b", milliseconds(200)), Decision::Accept);
+
+  // Once the dwell time is over, a takes over while b is still sending
+  EXPECT_EQ(Receive("a", milliseconds(1050)), Decision::AcceptAfterSwitch);
+  EXPECT_EQ(Receive("b", milliseconds(1100)), Decision::RejectBackup);
+  EXPECT_EQ(Receive("a", milliseconds(1150)), Decision::Accept);
+
+  // b never takes over from the preferred source while it is sending
+  for(int time = 2050; time < 5000; time += 100) {
+    ASSERT_EQ(Receive("a", milliseconds(time)), Decision::Accept);
+    ASSERT_EQ(Receive("b", milliseconds(time + 50)), Decision::RejectBackup);
+  }
+  EXPECT_EQ(selector_.GetMetrics().switch_count, 2u);
+}
+
+TEST_F(RefereeSourceSelectorTest, JitterWithinMarginDoesNotSwitch)
+{
+  // a arrives up to 25 ms late, and b 10 ms after a's nominal time
+  for(int time = 0; time < 10000; time += 100) {
+    const auto jitter = (time / 100) % 2 == 0 ? 0 : 25;
+    ASSERT_NE(Receive("a", milliseconds(time + jitter)), Decision::RejectBackup);
+    ASSERT_EQ(Receive("b", milliseconds(time + 10)), Decision::RejectBackup);
+  }
+  EXPECT_EQ(selector_.GetMetrics().switch_count, 1u);
+}
+
+TEST_F(RefereeSourceSelectorTest, LatePacketsDoNotFlapBetweenLiveSources)
+{
+  // Both sources are live and 50 ms out of phase. Each one is occasionally 80 ms late, which is
+  // enough for the other to take over, but the dwell time keeps them from taking turns.
+  for(int time = 0; time < 10000; time += 100) {
+    const auto a_jitter = (time / 100) % 3 == 0 ? 80 : 0;
+    const auto b_jitter = (time / 100) % 3 == 1 ? 80 : 0;
+    Receive("a", milliseconds(time + a_jitter));
+    Receive("b", milliseconds(time + 50 + b_jitter));
+  }
+  // At most one switch per dwell time, instead of one per late packet
+  EXPECT_LE(selector_.GetMetrics().switch_count, 11u);
+}
+
+TEST_F(RefereeSourceSelectorTest, BurstsDoNotShortenLearnedPeriod)
+{
+  // a sends two extra packets after every command change, and b is 95 ms out of phase
+  uint32_t command_counter = 0;
+  for(int time = 0; time < 5000; time += 100) {
+    ASSERT_NE(Receive("a", milliseconds(time), command_counter), Decision::RejectBackup);
+    if(time % 500 == 0) {
+      command_counter++;
+      ASSERT_NE(Receive("a", milliseconds(time + 1), command_counter), Decision::RejectBackup);
+      ASSERT_NE(Receive("a", milliseconds(time + 2), command_counter), Decision::RejectBackup);
+    }
+    ASSERT_EQ(Receive("b", milliseconds(time + 95)), Decision::RejectBackup);
+  }
+  EXPECT_EQ(selector_.GetMetrics().switch_count, 1u);
+}
+
+}  // namespace
@@ -0,0 +1,145 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "simulator_bridge/robot_command_batcher.hpp"
+
+namespace
+{
+
+using ssl_ros_bridge::simulator_bridge::RobotCommandBatcher;
+
+RobotCommand MakeCommand(const uint32_t id, const float kick_speed)
+{
+  RobotCommand command;
+  command.set_id(id);
+  command.set_kick_speed(kick_speed);
+  return command;
+}
+
+TEST(RobotCommandBatcherTest, EmptyBatchIsNotSent)
+{
+  RobotCommandBatcher batcher;
+  RobotControl control;
+  *control.add_robot_commands() = MakeCommand(1, 1.0f);
+
+  EXPECT_FALSE(batcher.TakeBatch(control));
+  // Leftovers from the previous batch must not be sent again
+  EXPECT_EQ(control.robot_commands_size(), 0);
+  EXPECT_EQ(batcher.GetMetrics().sent_batches, 0u);
+}
+
+TEST(RobotCommandBatcherTest, BatchesCommandsOrderedById)
+{
+  RobotCommandBatcher batcher;
+  for(const uint32_t id : {5, 0, 11, 3}) {
+    batcher.Add(MakeCommand(id, static_cast<float>(id)));
+  }
+  RobotControl control;
+
+  ASSERT_TRUE(batcher.TakeBatch(control));
+  ASSERT_EQ(control.robot_commands_size(), 4);
+  const std::vector<uint32_t> expected_ids{0, 3, 5, 11};
+  for(int i = 0; i < control.robot_commands_size(); ++i) {
+    EXPECT_EQ(control.robot_commands(i).id(), expected_ids[i]);
+    EXPECT_EQ(control.robot_commands(i).kick_speed(), static_cast<float>(expected_ids[i]));
+  }
+  EXPECT_FALSE(batcher.TakeBatch(control));
+}
+
+TEST(RobotCommandBatcherTest, KeepsLatestCommandPerRobot)
+{
+  RobotCommandBatcher batcher;
+  batcher.Add(MakeCommand(2, 1.0f));
+  batcher.Add(MakeCommand(4, 1.0f));
+  batcher.Add(MakeCommand(2, 3.0f));
+  // A newer command replaces the old one entirely, even fields it leaves unset
+  RobotCommand bare_command;
+  bare_command.set_id(4);
+  batcher.Add(bare_command);
+  RobotControl control;
+
+  ASSERT_TRUE(batcher.TakeBatch(control));
+  ASSERT_EQ(control.robot_commands_size(), 2);
+  EXPECT_EQ(control.robot_commands(0).kick_speed(), 3.0f);
+  EXPECT_FALSE(control.robot_commands(1).has_kick_speed());
+
+  const auto metrics = batcher.GetMetrics();
+  EXPECT_EQ(metrics.received_commands, 4u);
+  EXPECT_EQ(metrics.superseded_commands, 2u);
+  EXPECT_EQ(metrics.sent_batches, 1u);
+}
+
+TEST(RobotCommandBatcherTest, StartsFreshAfterEachBatch)
+{
+  RobotCommandBatcher batcher;
+  RobotControl control;
+  batcher.Add(MakeCommand(1, 1.0f));
+  batcher.Add(MakeCommand(2, 1.0f));
+  ASSERT_TRUE(batcher.TakeBatch(control));
+
+  batcher.Add(MakeCommand(2, 2.0f));
+  ASSERT_TRUE(batcher.TakeBatch(control));
+  ASSERT_EQ(control.robot_commands_size(), 1);
+  EXPECT_EQ(control.robot_commands(0).id(), 2u);
+  EXPECT_EQ(control.robot_commands(0).kick_speed(), 2.0f);
+
+  const auto metrics = batcher.GetMetrics();
+  EXPECT_EQ(metrics.superseded_commands, 0u);
+  EXPECT_EQ(metrics.sent_batches, 2u);
+}
+
+TEST(RobotCommandBatcherTest, ConcurrentAddsAreNeverLost)
+{
+  constexpr int kThreadCount = 4;
+  constexpr int kCommandsPerThread = 10000;
+  RobotCommandBatcher batcher;
+  std::vector<std::thread> threads;
+  for(int t = 0; t < kThreadCount; ++t) {
+    threads.emplace_back(
+      [&batcher, t]() {
+        for(int i = 0; i < kCommandsPerThread; ++i) {
+          batcher.Add(MakeCommand(t * 4 + i % 4, static_cast<float>(i)));
+        }
+      });
+  }
+  RobotControl control;
+  uint64_t batched_commands = 0;
+  for(int i = 0; i < 1000; ++i) {
+    if(batcher.TakeBatch(control)) {
+      batched_commands += control.robot_commands_size();
+    }
+  }
+  for(auto & thread : threads) {
+    thread.join();
+  }
+  if(batcher.TakeBatch(control)) {
+    batched_commands += control.robot_commands_size();
+  }
+
+  const auto metrics = batcher.GetMetrics();
+  EXPECT_EQ(metrics.received_commands, uint64_t{kThreadCount * kCommandsPerThread});
+  EXPECT_EQ(batched_commands + metrics.superseded_commands, metrics.received_commands);
+}
+
+}  // namespace
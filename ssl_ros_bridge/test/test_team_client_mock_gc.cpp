@@ -0,0 +1,113 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <mutex>
+#include <rclcpp/rclcpp.hpp>
+#include "mock_gc/mock_gc_server.hpp"
+#include "team_client/team_client.hpp"
+
+namespace
+{
+
+using ssl_ros_bridge::game_controller_bridge::TeamClient;
+using ssl_ros_bridge::mock_gc::MockGcServer;
+
+constexpr int kRequestCount = 2000;
+constexpr std::chrono::seconds kTimeout{20};
+
+struct RequestResults
+{
+  std::mutex mutex;
+  int completed_count{0};
+  int accepted_count{0};
+  std::promise<void> done_promise;
+
+  void Record(const bool accepted)
+  {
+    std::lock_guard lock(mutex);
+    completed_count++;
+    accepted_count += accepted ? 1 : 0;
+    if(completed_count == kRequestCount) {
+      done_promise.set_value();
+    }
+  }
+};
+
+class TeamClientMockGcStressTest : public ::testing::TestWithParam<std::size_t>
+{
+};
+
+TEST_P(TeamClientMockGcStressTest, PipelinedRequestsSurviveFragmentedReplies)
+{
+  MockGcServer::Options server_options;
+  server_options.port = 0;
+  server_options.fragment_size = GetParam();
+  MockGcServer server(server_options);
+
+  // Declared before the client so late callbacks never outlive it
+  RequestResults results;
+  std::promise<bool> connect_promise;
+
+  TeamClient client(rclcpp::get_logger("team_client_mock_gc_test"));
+  TeamClient::ConnectionParameters connection_parameters;
+  connection_parameters.address = boost::asio::ip::address_v4::loopback();
+  connection_parameters.port = server.GetPort();
+  connection_parameters.team_name = "Test Team";
+  connection_parameters.team_color = TeamClient::TeamColor::Auto;
+  client.Connect(
+    connection_parameters, [&connect_promise](bool connected) {
+      connect_promise.set_value(connected);
+    });
+  auto connect_future = connect_promise.get_future();
+  ASSERT_EQ(connect_future.wait_for(kTimeout), std::future_status::ready);
+  ASSERT_TRUE(connect_future.get());
+
+  // Alternate request types so replies of different lengths are interleaved on the stream
+  for(int i = 0; i < kRequestCount; ++i) {
+    if(i % 2 == 0) {
+      client.Ping(
+        [&results](const TeamClient::PingResult & result) {
+          results.Record(result.request_result.accepted);
+        });
+    } else {
+      client.SetDesiredKeeper(
+        i % 16, [&results](const TeamClient::Result & result) {
+          results.Record(result.accepted);
+        });
+    }
+  }
+
+  auto done_future = results.done_promise.get_future();
+  ASSERT_EQ(done_future.wait_for(kTimeout), std::future_status::ready);
+  std::lock_guard lock(results.mutex);
+  EXPECT_EQ(results.accepted_count, kRequestCount);
+  EXPECT_TRUE(client.IsConnected());
+  EXPECT_EQ(client.GetLinkStatistics().timeout_count, 0u);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  FragmentSizes, TeamClientMockGcStressTest,
+  ::testing::Values(std::size_t{0}, std::size_t{1}, std::size_t{3}, std::size_t{7}));
+
+}  // namespace
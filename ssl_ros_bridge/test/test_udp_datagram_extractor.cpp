@@ -0,0 +1,301 @@
+// Copyright 2026 A Team
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include "core/log_format.hpp"
+#include "core/pcap_reader.hpp"
+#include "core/udp_datagram_extractor.hpp"
+
+namespace
+{
+
+using ssl_ros_bridge::core::CapturedPacket;
+using ssl_ros_bridge::core::LinkType;
+using ssl_ros_bridge::core::UdpDatagram;
+using ssl_ros_bridge::core::UdpDatagramExtractor;
+using ssl_ros_bridge::core::log_format::WriteBigEndian;
+
+// 224.5.23.1 and 224.5.23.2
+constexpr uint32_t kRefereeAddress = 0xE0051701;
+constexpr uint32_t kVisionAddress = 0xE0051702;
+constexpr uint16_t kRefereePort = 10003;
+constexpr uint16_t kVisionPort = 10006;
+constexpr uint32_t kSourceAddress = 0xC0A80105;
+constexpr uint8_t kProtocolUdp = 17;
+constexpr int64_t kSecondNs = 1'000'000'000;
+
+std::vector<uint8_t> MakePayload(const std::size_t size)
+{
+  std::vector<uint8_t> payload(size);
+  for(std::size_t i = 0; i < size; ++i) {
+    payload[i] = static_cast<uint8_t>(i * 7);
+  }
+  return payload;
+}
+
+std::vector<uint8_t> MakeUdpPacket(const uint16_t port, const std::vector<uint8_t> & payload)
+{
+  std::vector<uint8_t> packet(8);
+  WriteBigEndian<uint16_t>(40000, packet.data());
+  WriteBigEndian<uint16_t>(port, packet.data() + 2);
+  WriteBigEndian<uint16_t>(packet.size() + payload.size(), packet.data() + 4);
+  packet.insert(packet.end(), payload.begin(), payload.end());
+  return packet;
+}
+
+struct Ipv4Fields
+{
+  uint32_t destination_address{kRefereeAddress};
+  uint16_t identification{1};
+  std::size_t fragment_offset{0};
+  bool more_fragments{false};
+  uint8_t protocol{kProtocolUdp};
+};
+
+std::vector<uint8_t> MakeIpv4Packet(const Ipv4Fields & fields, const std::vector<uint8_t> & payload)
+{
+  std::vector<uint8_t> packet(20);
+  packet[0] = 0x45;
+  WriteBigEndian<uint16_t>(packet.size() + payload.size(), packet.data() + 2);
+  WriteBigEndian<uint16_t>(fields.identification, packet.data() + 4);
+  WriteBigEndian<uint16_t>(
+    (fields.more_fragments ? 0x2000 : 0) | (fields.fragment_offset / 8), packet.data() + 6);
+  packet[8] = 64;
+  packet[9] = fields.protocol;
+  WriteBigEndian<uint32_t>(kSourceAddress, packet.data() + 12);
+  WriteBigEndian<uint32_t>(fields.destination_address, packet.data() + 16);
+  packet.insert(packet.end(), payload.begin(), payload.end());
+  return packet;
+}
+
+std::vector<uint8_t> MakeEthernetFrame(
+  const std::vector<uint8_t> & ip_packet, const int vlan_tag_count = 0)
+{
+  std::vector<uint8_t> frame(12, 0xEE);
+  for(int i = 0; i < vlan_tag_count; ++i) {
+    frame.insert(frame.end(), {0x81, 0x00, 0x00, 0x05});
+  }
+  frame.insert(frame.end(), {0x08, 0x00});
+  frame.insert(frame.end(), ip_packet.begin(), ip_packet.end());
+  return frame;
+}
+
+/**
+ * Splits a UDP packet into IP packets carrying at most fragment_size bytes, a multiple of eight.
+ */
+std::vector<std::vector<uint8_t>> MakeFragments(
+  const std::vector<uint8_t> & udp_packet, const std::size_t fragment_size,
+  const uint16_t identification = 1)
+{
+  std::vector<std::vector<uint8_t>> fragments;
+  for(std::size_t offset = 0; offset < udp_packet.size(); offset += fragment_size) {
+    const auto end = std::min(offset + fragment_size, udp_packet.size());
+    Ipv4Fields fields;
+    fields.identification = identification;
+    fields.fragment_offset = offset;
+    fields.more_fragments = end < udp_packet.size();
+    fragments.push_back(MakeIpv4Packet(
+        fields, std::vector<uint8_t>(udp_packet.begin() + offset, udp_packet.begin() + end)));
+  }
+  return fragments;
+}
+
+class UdpDatagramExtractorTest : public ::testing::Test
+{
+protected:
+  UdpDatagramExtractor extractor_{{{kRefereeAddress, kRefereePort}, {kVisionAddress, kVisionPort}}};
+
+  std::optional<UdpDatagram> Add(
+    const std::vector<uint8_t> & data, const int64_t capture_time_ns = 0,
+    const LinkType link_type = LinkType::Raw)
+  {
+    return extractor_.AddPacket(CapturedPacket{capture_time_ns, link_type, data});
+  }
+};
+
+void ExpectPayload(
+  const std::optional<UdpDatagram> & datagram, const std::vector<uint8_t> & payload)
+{
+  ASSERT_TRUE(datagram.has_value());
+  EXPECT_EQ(std::vector<uint8_t>(datagram->payload.begin(), datagram->payload.end()), payload);
+}
+
+TEST_F(UdpDatagramExtractorTest, ExtractsDatagramForEachEndpoint)
+{
+  const auto payload = MakePayload(100);
+  Ipv4Fields vision_fields;
+  vision_fields.destination_address = kVisionAddress;
+
+  const auto referee = Add(MakeIpv4Packet({}, MakeUdpPacket(kRefereePort, payload)), 42);
+  ExpectPayload(referee, payload);
+  EXPECT_EQ(referee->endpoint_index, 0u);
+  EXPECT_EQ(referee->capture_time_ns, 42);
+  const auto vision = Add(MakeIpv4Packet(vision_fields, MakeUdpPacket(kVisionPort, payload)));
+  ExpectPayload(vision, payload);
+  EXPECT_EQ(vision->endpoint_index, 1u);
+}
+
+TEST_F(UdpDatagramExtractorTest, IgnoresOtherTraffic)
+{
+  const auto udp_packet = MakeUdpPacket(kRefereePort, MakePayload(10));
+  Ipv4Fields other_address;
+  other_address.destination_address = 0xE0051703;
+  Ipv4Fields tcp;
+  tcp.protocol = 6;
+
+  EXPECT_FALSE(Add(MakeIpv4Packet(other_address, udp_packet)));
+  EXPECT_FALSE(Add(MakeIpv4Packet(tcp, udp_packet)));
+  EXPECT_FALSE(Add(MakeIpv4Packet({}, MakeUdpPacket(kVisionPort, MakePayload(10)))));
+  // Cut short by the snapshot length
+  auto truncated = MakeIpv4Packet({}, udp_packet);
+  truncated.resize(truncated.size() - 4);
+  EXPECT_FALSE(Add(truncated));
+}
+
+TEST_F(UdpDatagramExtractorTest, MatchesAnyAddressEndpoint)
+{
+  UdpDatagramExtractor extractor({{0, kRefereePort}});
+  Ipv4Fields fields;
+  fields.destination_address = 0x7F000001;
+  const auto packet = MakeIpv4Packet(fields, MakeUdpPacket(kRefereePort, MakePayload(10)));
+
+  EXPECT_TRUE(extractor.AddPacket({0, LinkType::Raw, packet}).has_value());
+}
+
+TEST_F(UdpDatagramExtractorTest, ReadsLinkLayerHeaders)
+{
+  const auto payload = MakePayload(20);
+  const auto ip_packet = MakeIpv4Packet({}, MakeUdpPacket(kRefereePort, payload));
+
+  ExpectPayload(Add(MakeEthernetFrame(ip_packet), 0, LinkType::Ethernet), payload);
+  ExpectPayload(Add(MakeEthernetFrame(ip_packet, 2), 0, LinkType::Ethernet), payload);
+
+  // Short frames are padded to the Ethernet minimum
+  auto padded_frame = MakeEthernetFrame(ip_packet);
+  padded_frame.resize(padded_frame.size() + 18, 0);
+  ExpectPayload(Add(padded_frame, 0, LinkType::Ethernet), payload);
+
+  std::vector<uint8_t> sll_frame(14, 0);
+  sll_frame.insert(sll_frame.end(), {0x08, 0x00});
+  sll_frame.insert(sll_frame.end(), ip_packet.begin(), ip_packet.end());
+  ExpectPayload(Add(sll_frame, 0, LinkType::LinuxSll), payload);
+
+  std::vector<uint8_t> sll2_frame{0x08, 0x00};
+  sll2_frame.resize(20, 0);
+  sll2_frame.insert(sll2_frame.end(), ip_packet.begin(), ip_packet.end());
+  ExpectPayload(Add(sll2_frame, 0, LinkType::LinuxSll2), payload);
+
+  // The address family is written in the byte order of the capturing machine
+  for(const uint8_t family_offset : {0, 3}) {
+    std::vector<uint8_t> null_frame(4, 0);
+    null_frame[family_offset] = 2;
+    null_frame.insert(null_frame.end(), ip_packet.begin(), ip_packet.end());
+    ExpectPayload(Add(null_frame, 0, LinkType::Null), payload);
+  }
+
+  auto ipv6_frame = MakeEthernetFrame(ip_packet);
+  ipv6_frame[12] = 0x86;
+  ipv6_frame[13] = 0xDD;
+  EXPECT_FALSE(Add(ipv6_frame, 0, LinkType::Ethernet));
+}
+
+TEST_F(UdpDatagramExtractorTest, ReassemblesFragmentsInOrder)
+{
+  const auto payload = MakePayload(4000);
+  const auto fragments = MakeFragments(MakeUdpPacket(kRefereePort, payload), 1480);
+  ASSERT_EQ(fragments.size(), 3u);
+
+  EXPECT_FALSE(Add(fragments[0], 0));
+  EXPECT_FALSE(Add(fragments[1], 1));
+  const auto datagram = Add(fragments[2], 2);
+  ExpectPayload(datagram, payload);
+  EXPECT_EQ(datagram->capture_time_ns, 2);
+  EXPECT_EQ(extractor_.GetIncompleteDatagramCount(), 0u);
+}
+
+TEST_F(UdpDatagramExtractorTest, ReassemblesFragmentsOutOfOrderWithDuplicates)
+{
+  const auto payload = MakePayload(4000);
+  const auto fragments = MakeFragments(MakeUdpPacket(kRefereePort, payload), 1000);
+  ASSERT_EQ(fragments.size(), 5u);
+
+  for(const auto index : {4, 2, 2, 0, 3}) {
+    EXPECT_FALSE(Add(fragments[index]));
+  }
+  ExpectPayload(Add(fragments[1]), payload);
+}
+
+TEST_F(UdpDatagramExtractorTest, ReassemblesOverlappingFragments)
+{
+  const auto udp_packet = MakeUdpPacket(kRefereePort, MakePayload(2000));
+  const auto large_fragments = MakeFragments(udp_packet, 1200);
+  const auto small_fragments = MakeFragments(udp_packet, 800);
+
+  // Covers bytes 0 to 800 and 1200 to the end, leaving a gap until the last fragment
+  EXPECT_FALSE(Add(small_fragments[0]));
+  EXPECT_FALSE(Add(large_fragments[1]));
+  ExpectPayload(Add(small_fragments[1]), MakePayload(2000));
+}
+
+TEST_F(UdpDatagramExtractorTest, KeepsInterleavedDatagramsApart)
+{
+  const auto first_payload = MakePayload(3000);
+  const auto second_payload = std::vector<uint8_t>(3000, 0x55);
+  const auto first = MakeFragments(MakeUdpPacket(kRefereePort, first_payload), 1480, 7);
+  const auto second = MakeFragments(MakeUdpPacket(kRefereePort, second_payload), 1480, 8);
+  ASSERT_EQ(first.size(), second.size());
+
+  for(std::size_t i = 0; i + 1 < first.size(); ++i) {
+    EXPECT_FALSE(Add(first[i]));
+    EXPECT_FALSE(Add(second[i]));
+  }
+  ExpectPayload(Add(second.back()), second_payload);
+  ExpectPayload(Add(first.back()), first_payload);
+}
+
+TEST_F(UdpDatagramExtractorTest, DiscardsIncompleteDatagramsAfterTimeout)
+{
+  const auto fragments = MakeFragments(MakeUdpPacket(kRefereePort, MakePayload(3000)), 1480);
+
+  EXPECT_FALSE(Add(fragments[0], 0));
+  // A later datagram's fragment is enough to expire the first one
+  const auto later = MakeFragments(MakeUdpPacket(kRefereePort, MakePayload(3000)), 1480, 2);
+  EXPECT_FALSE(Add(later[0], 6 * kSecondNs));
+  EXPECT_EQ(extractor_.GetIncompleteDatagramCount(), 1u);
+
+  // The rest of the expired datagram cannot complete it any more
+  EXPECT_FALSE(Add(fragments[1], 6 * kSecondNs));
+  EXPECT_FALSE(Add(fragments[2], 6 * kSecondNs));
+}
+
+TEST_F(UdpDatagramExtractorTest, LimitsPendingDatagrams)
+{
+  const auto udp_packet = MakeUdpPacket(kRefereePort, MakePayload(3000));
+  for(uint16_t identification = 0; identification < 300; ++identification) {
+    EXPECT_FALSE(Add(MakeFragments(udp_packet, 1480, identification).front()));
+  }
+  EXPECT_EQ(extractor_.GetIncompleteDatagramCount(), 300u - 256u);
+}
+
+}  // namespace